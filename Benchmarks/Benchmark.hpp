@@ -0,0 +1,105 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+//==========================================================================
+// Shared helpers for the benchmark executables. Replaces the global
+// allocation functions to count heap allocations, so this header must be
+// included by exactly one translation unit per benchmark executable.
+// Results are printed as a table, or as one JSON object per line when the
+// BENCHMARK_FORMAT environment variable is set to json.
+//==========================================================================
+namespace Benchmark
+{
+    static std::atomic< size_t > Allocations{ 0 };
+
+    // Prevent the compiler from optimising away a value.
+    template < typename T >
+    inline void DoNotOptimise( T&& a_Value )
+    {
+#if defined( __GNUC__ ) || defined( __clang__ )
+        asm volatile( "" : : "g"( &a_Value ) : "memory" );
+#else
+        static volatile const void* Sink;
+        Sink = &a_Value;
+#endif
+    }
+
+    // Result of a measured run.
+    struct Result
+    {
+        double NanosecondsPerOp;
+        double AllocationsPerOp;
+    };
+
+    // Run a_Function a_Iterations times and measure time and heap allocations per iteration.
+    template < typename Function >
+    Result Measure( size_t a_Iterations, Function&& a_Function )
+    {
+        size_t AllocationsBefore = Allocations.load( std::memory_order_relaxed );
+        auto Begin = std::chrono::steady_clock::now();
+
+        for ( size_t i = 0; i < a_Iterations; ++i )
+        {
+            a_Function( i );
+        }
+
+        auto End = std::chrono::steady_clock::now();
+        size_t AllocationsAfter = Allocations.load( std::memory_order_relaxed );
+
+        return Result{
+            std::chrono::duration< double, std::nano >( End - Begin ).count() / a_Iterations,
+            static_cast< double >( AllocationsAfter - AllocationsBefore ) / a_Iterations
+        };
+    }
+
+    // Are results printed as JSON lines rather than a table.
+    inline bool IsJson()
+    {
+        static const bool Json = std::getenv( "BENCHMARK_FORMAT" ) && std::strcmp( std::getenv( "BENCHMARK_FORMAT" ), "json" ) == 0;
+        return Json;
+    }
+
+    // Print a line that is not a result, to stderr when results are printed as JSON so that stdout stays parseable.
+    template < typename... T >
+    inline void Print( const char* a_Format, T... a_Args )
+    {
+        std::fprintf( IsJson() ? stderr : stdout, a_Format, a_Args... );
+    }
+
+    // Print a result row. Names are printed as given, so they must not contain quotes or backslashes.
+    inline void Report( const char* a_Name, const Result& a_Result )
+    {
+        if ( IsJson() )
+        {
+            std::printf( "{\"name\": \"%s\", \"ns_per_op\": %.3f, \"allocs_per_op\": %.4f}\n", a_Name, a_Result.NanosecondsPerOp, a_Result.AllocationsPerOp );
+        }
+        else
+        {
+            std::printf( "%-48s %10.2f ns/op %8.3f allocs/op\n", a_Name, a_Result.NanosecondsPerOp, a_Result.AllocationsPerOp );
+        }
+    }
+}
+
+#if defined( __GNUC__ ) && !defined( __clang__ )
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void* operator new( size_t a_Size )
+{
+    Benchmark::Allocations.fetch_add( 1, std::memory_order_relaxed );
+
+    if ( void* Pointer = std::malloc( a_Size ? a_Size : 1 ) )
+    {
+        return Pointer;
+    }
+
+    throw std::bad_alloc();
+}
+
+void operator delete( void* a_Pointer ) noexcept { std::free( a_Pointer ); }
+void operator delete( void* a_Pointer, size_t ) noexcept { std::free( a_Pointer ); }
@@ -0,0 +1,81 @@
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../Callable/ConcurrentDelegate.hpp"
+
+static void Listen( int& a_Count ) { ++a_Count; }
+
+struct Subscriber
+{
+	void OnEvent( int& a_Count ) { a_Count += 2; }
+};
+
+// Broadcast from a_Readers threads for a fixed duration while one writer adds and removes a subscriber, and report the total
+// broadcast throughput.
+static void Run( size_t a_Readers )
+{
+	static constexpr auto Duration = std::chrono::milliseconds( 200 );
+
+	ConcurrentDelegate< void, int& > Event;
+	Subscriber Churn;
+
+	for ( size_t i = 0; i < 16; ++i )
+	{
+		Event += Listen;
+	}
+
+	std::atomic< bool > IsRunning{ true };
+	std::atomic< size_t > Broadcasts{ 0 };
+	std::vector< std::thread > Threads;
+
+	for ( size_t i = 0; i < a_Readers; ++i )
+	{
+		Threads.emplace_back( [&]()
+		{
+			size_t Count = 0;
+			int Sum = 0;
+
+			while ( IsRunning.load( std::memory_order_relaxed ) )
+			{
+				Event( Sum );
+				++Count;
+			}
+
+			Benchmark::DoNotOptimise( Sum );
+			Broadcasts.fetch_add( Count, std::memory_order_relaxed );
+		} );
+	}
+
+	size_t Writes = 0;
+	auto Begin = std::chrono::steady_clock::now();
+
+	while ( std::chrono::steady_clock::now() - Begin < Duration )
+	{
+		Event.Add< &Subscriber::OnEvent >( &Churn );
+		Event.Remove< &Subscriber::OnEvent >( &Churn );
+		Writes += 2;
+	}
+
+	IsRunning.store( false, std::memory_order_relaxed );
+
+	for ( std::thread& Thread : Threads )
+	{
+		Thread.join();
+	}
+
+	double Seconds = std::chrono::duration< double >( std::chrono::steady_clock::now() - Begin ).count();
+	Benchmark::Print( "%2zu readers, 1 writer %27s %10.2f Mbroadcasts/s %8.2f Mwrites/s\n", a_Readers, "", Broadcasts.load() / Seconds / 1e6, Writes / Seconds / 1e6 );
+}
+
+int main()
+{
+	Benchmark::Print( "hardware threads: %u\n", std::thread::hardware_concurrency() );
+
+	for ( size_t Readers : { 1, 2, 4, 8 } )
+	{
+		Run( Readers );
+	}
+}
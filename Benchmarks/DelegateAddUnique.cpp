@@ -0,0 +1,49 @@
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../Callable/Delegate.hpp"
+
+struct Listener
+{
+	int Count = 0;
+	void OnEvent() { ++Count; }
+};
+
+template < typename _Delegate >
+void Run( const char* a_Build, const char* a_Remove, std::vector< Listener >& a_Targets )
+{
+	static constexpr size_t Churn = 1 << 14;
+
+	_Delegate Event;
+
+	// Each iteration adds one more unique listener, so building the delegate is measured as a whole.
+	Benchmark::Report( a_Build, Benchmark::Measure( a_Targets.size(), [&]( size_t i )
+	{
+		Event.template AddUnique< &Listener::OnEvent >( &a_Targets[ i ] );
+	} ) );
+
+	size_t Next = 0;
+	Benchmark::Report( a_Remove, Benchmark::Measure( Churn, [&]( size_t )
+	{
+		Next = ( Next + 7919 ) % a_Targets.size();
+		Event.template Remove< &Listener::OnEvent >( &a_Targets[ Next ] );
+		Event.template AddUnique< &Listener::OnEvent >( &a_Targets[ Next ] );
+	} ) );
+
+	Event();
+}
+
+int main()
+{
+	std::vector< Listener > Targets( 10000 );
+
+	Run< Delegate< void > >( "10000 listeners, add unique", "10000 listeners, remove by member function", Targets );
+	Run< HashedDelegate< void > >( "10000 listeners, hashed, add unique", "10000 listeners, hashed, remove by member function", Targets );
+
+	int Sum = 0;
+	for ( const Listener& Target : Targets )
+	{
+		Sum += Target.Count;
+	}
+	Benchmark::DoNotOptimise( Sum );
+}
@@ -0,0 +1,62 @@
+#include <cstdio>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../Callable/Delegate.hpp"
+
+// Argument that is expensive to copy and counts how often it is copied and moved.
+struct Heavy
+{
+	static inline size_t Copies = 0;
+	static inline size_t Moves = 0;
+
+	std::vector< int > Values;
+
+	Heavy() : Values( 64, 1 ) {}
+	Heavy( const Heavy& a_Other ) : Values( a_Other.Values ) { ++Copies; }
+	Heavy( Heavy&& a_Other ) noexcept : Values( std::move( a_Other.Values ) ) { ++Moves; }
+};
+
+struct Listener
+{
+	int Sum = 0;
+	void ByReference( const Heavy& a_Value ) { Sum += static_cast< int >( a_Value.Values.size() ); }
+	void ByValue( Heavy a_Value ) { Sum += static_cast< int >( a_Value.Values.size() ); }
+};
+
+template < typename Function >
+static void Run( const char* a_Name, size_t a_Iterations, Function&& a_Function )
+{
+	Heavy::Copies = 0;
+	Heavy::Moves = 0;
+	Benchmark::Report( a_Name, Benchmark::Measure( a_Iterations, a_Function ) );
+	Benchmark::Print( "%-48s %10.2f copies/op %6.2f moves/op\n", "", static_cast< double >( Heavy::Copies ) / a_Iterations, static_cast< double >( Heavy::Moves ) / a_Iterations );
+}
+
+int main()
+{
+	static constexpr size_t Listeners = 8;
+	static constexpr size_t Iterations = 1 << 16;
+
+	Listener Targets[ Listeners ];
+	Delegate< void, Heavy > ReferenceListeners;
+	Delegate< void, Heavy > ValueListeners;
+
+	for ( Listener& Target : Targets )
+	{
+		ReferenceListeners.Add< &Listener::ByReference >( &Target );
+		ValueListeners.Add< &Listener::ByValue >( &Target );
+	}
+
+	Heavy Argument;
+	Run( "broadcast lvalue, 8 listeners by const&", Iterations, [&]( size_t ) { ReferenceListeners( Argument ); } );
+	Run( "broadcast rvalue, 8 listeners by const&", Iterations, [&]( size_t ) { ReferenceListeners( Heavy() ); } );
+	Run( "broadcast lvalue, 8 listeners by value", Iterations, [&]( size_t ) { ValueListeners( Argument ); } );
+
+	int Sum = 0;
+	for ( const Listener& Target : Targets )
+	{
+		Sum += Target.Sum;
+	}
+	Benchmark::DoNotOptimise( Sum );
+}
@@ -0,0 +1,45 @@
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../Callable/Delegate.hpp"
+
+struct Enemy
+{
+	float Position = 0.0f;
+	float Velocity = 1.0f;
+	void OnTick( float a_DeltaTime ) { Position += Velocity * a_DeltaTime; }
+};
+
+template < typename DelegateType >
+static void Run( const char* a_Name, std::vector< Enemy >& a_Enemies, size_t a_Passes )
+{
+	DelegateType Tick;
+
+	for ( Enemy& Target : a_Enemies )
+	{
+		Tick.template Add< &Enemy::OnTick >( &Target );
+	}
+
+	Benchmark::Result Result = Benchmark::Measure( a_Passes, [&]( size_t ) { Tick( 0.016f ); } );
+	Result.NanosecondsPerOp /= a_Enemies.size();
+	Benchmark::Report( a_Name, Result );
+}
+
+int main()
+{
+	static constexpr size_t Count = 50000;
+	static constexpr size_t Passes = 200;
+
+	// Results are per listener call.
+	std::vector< Enemy > Enemies( Count );
+	Run< Delegate< void, float > >( "tick 50k enemies, indirect call per enemy", Enemies, Passes );
+	Run< SoaDelegate< void, float > >( "tick 50k enemies, structure of arrays", Enemies, Passes );
+	Run< BatchDelegate< void, float > >( "tick 50k enemies, batched", Enemies, Passes );
+
+	float Sum = 0.0f;
+	for ( const Enemy& Target : Enemies )
+	{
+		Sum += Target.Position;
+	}
+	Benchmark::DoNotOptimise( Sum );
+}
@@ -0,0 +1,57 @@
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../Callable/Delegate.hpp"
+
+// Instrumented delegate keeping counts, but no latency histogram, for each listener.
+struct CountedDelegateTraits : InstrumentedDelegateTraits
+{
+	static constexpr bool ListenerLatencies = false;
+};
+
+struct Listener
+{
+	int Sum = 0;
+	void OnEvent( int a_Value ) { Sum += a_Value; }
+};
+
+template < typename _Delegate >
+void Run( const char* a_Name, _Delegate& a_Event, std::vector< Listener >& a_Listeners, size_t a_Passes )
+{
+	for ( Listener& Target : a_Listeners )
+	{
+		a_Event.template Add< &Listener::OnEvent >( &Target );
+	}
+
+	Benchmark::Report( a_Name, Benchmark::Measure( a_Passes, [&]( size_t i ) { a_Event( static_cast< int >( i ) ); } ) );
+}
+
+int main()
+{
+	static constexpr size_t Count = 10000;
+	static constexpr size_t Passes = 1000;
+
+	std::vector< Listener > Listeners( Count );
+
+	Delegate< void, int > Plain;
+	Run( "10000 listeners, broadcast", Plain, Listeners, Passes );
+
+	InstrumentedDelegate< void, int > Instrumented;
+	Run( "10000 listeners, instrumented, broadcast", Instrumented, Listeners, Passes );
+
+	DelegateStatistics Statistics;
+	Benchmark::Report( "10000 listeners, instrumented, snapshot", Benchmark::Measure( 10, [&]( size_t ) { Statistics = Instrumented.GetStatistics(); } ) );
+	Benchmark::DoNotOptimise( Statistics );
+
+	BasicDelegate< CountedDelegateTraits, void, int > Counted;
+	Run( "10000 listeners, instrumented without listener latencies, broadcast", Counted, Listeners, Passes );
+	Benchmark::Report( "10000 listeners, instrumented without listener latencies, snapshot", Benchmark::Measure( 10, [&]( size_t ) { Statistics = Counted.GetStatistics(); } ) );
+	Benchmark::DoNotOptimise( Statistics );
+
+	int Sum = 0;
+	for ( const Listener& Target : Listeners )
+	{
+		Sum += Target.Sum;
+	}
+	Benchmark::DoNotOptimise( Sum );
+}
@@ -0,0 +1,43 @@
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../Callable/Delegate.hpp"
+
+struct Listener
+{
+	int Sum = 0;
+	void OnEvent( int a_Value ) { Sum += a_Value; }
+};
+
+template < typename DelegateType >
+static void Run( const char* a_Name, std::vector< Listener >& a_Listeners, size_t a_Passes )
+{
+	DelegateType Event;
+
+	for ( Listener& Target : a_Listeners )
+	{
+		Event.template Add< &Listener::OnEvent >( &Target );
+	}
+
+	Benchmark::Result Result = Benchmark::Measure( a_Passes, [&]( size_t i ) { Event( static_cast< int >( i ) ); } );
+	Result.NanosecondsPerOp /= a_Listeners.size();
+	Benchmark::Report( a_Name, Result );
+}
+
+int main()
+{
+	static constexpr size_t Count = 50000;
+	static constexpr size_t Passes = 200;
+
+	// Results are per listener call.
+	std::vector< Listener > Listeners( Count );
+	Run< Delegate< void, int > >( "broadcast 50k listeners, array of invokers", Listeners, Passes );
+	Run< SoaDelegate< void, int > >( "broadcast 50k listeners, structure of arrays", Listeners, Passes );
+
+	int Sum = 0;
+	for ( const Listener& Target : Listeners )
+	{
+		Sum += Target.Sum;
+	}
+	Benchmark::DoNotOptimise( Sum );
+}
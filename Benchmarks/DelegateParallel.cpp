@@ -0,0 +1,54 @@
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../Callable/Delegate.hpp"
+#include "../Callable/ThreadPool.hpp"
+
+// Listener doing a moderate amount of independent work per call.
+struct Particle
+{
+	float Position = 1.0f;
+
+	void OnStep( float a_DeltaTime )
+	{
+		for ( int i = 0; i < 64; ++i )
+		{
+			Position = std::sqrt( Position * Position + a_DeltaTime );
+		}
+	}
+};
+
+int main()
+{
+	static constexpr size_t Count = 10000;
+	static constexpr size_t Passes = 50;
+
+	WorkStealingPool& Pool = WorkStealingPool::GetDefault();
+	Benchmark::Print( "pool workers: %zu\n", Pool.Size() );
+
+	std::vector< Particle > Particles( Count );
+	ParallelDelegate< void, float > Step;
+
+	for ( Particle& Target : Particles )
+	{
+		Step.AddParallel< &Particle::OnStep >( &Target );
+	}
+
+	Benchmark::Report( "10k listeners, serial broadcast", Benchmark::Measure( Passes, [&]( size_t ) { Step( 0.01f ); } ) );
+
+	for ( size_t Grain : { 64, 256, 1024 } )
+	{
+		char Name[ 64 ];
+		std::snprintf( Name, sizeof( Name ), "10k listeners, parallel broadcast, grain %zu", Grain );
+		Benchmark::Report( Name, Benchmark::Measure( Passes, [&]( size_t ) { Step.BroadcastParallel( Pool, Grain, 0.01f ); } ) );
+	}
+
+	float Sum = 0.0f;
+	for ( const Particle& Target : Particles )
+	{
+		Sum += Target.Position;
+	}
+	Benchmark::DoNotOptimise( Sum );
+}
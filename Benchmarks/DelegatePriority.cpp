@@ -0,0 +1,58 @@
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../Callable/Delegate.hpp"
+
+struct Listener
+{
+	int Count = 0;
+	void OnEvent() { ++Count; }
+};
+
+struct PriorityHandleTraits : PriorityDelegateTraits
+{
+	static constexpr bool Handles = true;
+};
+
+int main()
+{
+	static constexpr size_t Listeners = 10000;
+	static constexpr int32_t Priorities = 8;
+	static constexpr size_t Churn = 1 << 14;
+
+	std::vector< Listener > Targets( Listeners );
+	std::vector< DelegateHandle > Handles( Listeners );
+	Delegate< void > ByIndex;
+	BasicDelegate< PriorityHandleTraits, void > ByPriority;
+
+	for ( size_t i = 0; i < Listeners; ++i )
+	{
+		Handles[ i ] = ByPriority.Add< &Listener::OnEvent >( DelegatePriority( static_cast< int32_t >( i ) % Priorities ), &Targets[ i ] );
+		ByIndex.Add< &Listener::OnEvent >( &Targets[ i ] );
+	}
+
+	// Each iteration takes one listener out and adds it back in the middle of the invocation list.
+	size_t Next = 0;
+	Benchmark::Report( "10000 listeners, remove and insert at index", Benchmark::Measure( Churn, [&]( size_t )
+	{
+		Next = ( Next + 7919 ) % Listeners;
+		ByIndex.Remove( ByIndex.Size() - 1 );
+		ByIndex.Add< &Listener::OnEvent >( ByIndex.Size() / 2, &Targets[ Next ] );
+	} ) );
+
+	Benchmark::Report( "10000 listeners, 8 priorities, remove and add", Benchmark::Measure( Churn, [&]( size_t )
+	{
+		Next = ( Next + 7919 ) % Listeners;
+		ByPriority.Remove( Handles[ Next ] );
+		Handles[ Next ] = ByPriority.Add< &Listener::OnEvent >( DelegatePriority( static_cast< int32_t >( Next ) % Priorities ), &Targets[ Next ] );
+	} ) );
+
+	Benchmark::Report( "broadcast 10000 listeners, 8 priorities", Benchmark::Measure( 1000, [&]( size_t ) { ByPriority(); } ) );
+
+	int Sum = 0;
+	for ( const Listener& Target : Targets )
+	{
+		Sum += Target.Count;
+	}
+	Benchmark::DoNotOptimise( Sum );
+}
@@ -0,0 +1,68 @@
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../Callable/Delegate.hpp"
+
+struct Entity
+{
+	int Count = 0;
+	void OnMove() { ++Count; }
+	void OnDamage() { ++Count; }
+	void OnDestroy() { ++Count; }
+};
+
+template < typename _Delegate >
+void Subscribe( _Delegate& a_Event, std::vector< Entity >& a_Entities )
+{
+	for ( Entity& Target : a_Entities )
+	{
+		a_Event.template Add< &Entity::OnMove >( &Target );
+		a_Event.template Add< &Entity::OnDamage >( &Target );
+		a_Event.template Add< &Entity::OnDestroy >( &Target );
+	}
+}
+
+int main()
+{
+	static constexpr size_t Entities = 5000;
+
+	std::vector< Entity > Targets( Entities );
+
+	// Tearing down every entity, each removing each of its bindings, against removing all of its bindings at once.
+	Delegate< void > PerBinding;
+	Subscribe( PerBinding, Targets );
+
+	Benchmark::Report( "5000 entities, 3 bindings each, teardown by remove", Benchmark::Measure( 1, [&]( size_t )
+	{
+		for ( Entity& Target : Targets )
+		{
+			PerBinding.Remove< &Entity::OnMove >( &Target );
+			PerBinding.Remove< &Entity::OnDamage >( &Target );
+			PerBinding.Remove< &Entity::OnDestroy >( &Target );
+		}
+	} ) );
+
+	Delegate< void > PerObject;
+	Subscribe( PerObject, Targets );
+
+	Benchmark::Report( "5000 entities, 3 bindings each, teardown by remove object", Benchmark::Measure( 1, [&]( size_t )
+	{
+		for ( Entity& Target : Targets )
+		{
+			PerObject.RemoveObject( &Target );
+		}
+	} ) );
+
+	ObjectDelegate< void > Indexed;
+	Subscribe( Indexed, Targets );
+
+	Benchmark::Report( "5000 entities, 3 bindings each, object index, teardown by remove object", Benchmark::Measure( 1, [&]( size_t )
+	{
+		for ( Entity& Target : Targets )
+		{
+			Indexed.RemoveObject( &Target );
+		}
+	} ) );
+
+	Benchmark::DoNotOptimise( PerBinding.Size() + PerObject.Size() + Indexed.Size() );
+}
@@ -0,0 +1,74 @@
+#include <algorithm>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../Callable/Delegate.hpp"
+
+struct Listener
+{
+	int Sum = 0;
+	void OnEvent( int a_Value ) { Sum += a_Value; }
+};
+
+// Measure adding, adding uniquely, removing and broadcasting with a_Count listeners. Operations that search the invocation list
+// are repeated fewer times as it grows, to keep every size within a similar time.
+void Run( size_t a_Count )
+{
+	const size_t Searches = std::clamp< size_t >( ( 1 << 22 ) / a_Count, 16, 4096 );
+	const size_t Broadcasts = std::clamp< size_t >( ( 1 << 24 ) / a_Count, 4, 100000 );
+
+	std::vector< Listener > Listeners( a_Count );
+	std::vector< DelegateHandle > Handles( a_Count );
+	HandleDelegate< void, int > Event;
+	char Name[ 128 ];
+
+	// Each iteration adds one more listener, so building the delegate is measured as a whole.
+	std::snprintf( Name, sizeof( Name ), "delegate, %zu listeners, add", a_Count );
+	Benchmark::Report( Name, Benchmark::Measure( a_Count, [&]( size_t i ) { Handles[ i ] = Event.Add< &Listener::OnEvent >( &Listeners[ i ] ); } ) );
+
+	std::snprintf( Name, sizeof( Name ), "delegate, %zu listeners, broadcast", a_Count );
+	Benchmark::Report( Name, Benchmark::Measure( Broadcasts, [&]( size_t i ) { Event( static_cast< int >( i ) ); } ) );
+
+	// Each iteration removes one listener and subscribes it again, as a churning subscriber would.
+	size_t Next = 0;
+	std::snprintf( Name, sizeof( Name ), "delegate, %zu listeners, remove by handle", a_Count );
+	Benchmark::Report( Name, Benchmark::Measure( Searches, [&]( size_t )
+	{
+		Next = ( Next + 7919 ) % a_Count;
+		Event.Remove( Handles[ Next ] );
+		Handles[ Next ] = Event.Add< &Listener::OnEvent >( &Listeners[ Next ] );
+	} ) );
+
+	std::snprintf( Name, sizeof( Name ), "delegate, %zu listeners, remove by member function", a_Count );
+	Benchmark::Report( Name, Benchmark::Measure( Searches, [&]( size_t )
+	{
+		Next = ( Next + 7919 ) % a_Count;
+		Event.Remove< &Listener::OnEvent >( &Listeners[ Next ] );
+		Handles[ Next ] = Event.Add< &Listener::OnEvent >( &Listeners[ Next ] );
+	} ) );
+
+	std::snprintf( Name, sizeof( Name ), "delegate, %zu listeners, add unique", a_Count );
+	Benchmark::Report( Name, Benchmark::Measure( Searches, [&]( size_t )
+	{
+		Next = ( Next + 7919 ) % a_Count;
+		Event.Remove( Handles[ Next ] );
+		Handles[ Next ] = Event.AddUnique< &Listener::OnEvent >( &Listeners[ Next ] );
+	} ) );
+
+	int Sum = 0;
+	for ( const Listener& Target : Listeners )
+	{
+		Sum += Target.Sum;
+	}
+	Benchmark::DoNotOptimise( Sum );
+}
+
+int main()
+{
+	for ( size_t Count = 1; Count <= 1000000; Count *= 10 )
+	{
+		Run( Count );
+	}
+
+	return 0;
+}
@@ -0,0 +1,62 @@
+#include <string>
+#include <vector>
+
+// Tracing is compiled in here even when the CALLABLE_TRACING option is off.
+#ifndef CALLABLE_TRACING
+#define CALLABLE_TRACING 1
+#endif
+
+#include "Benchmark.hpp"
+#include "../Callable/Delegate.hpp"
+#include "../Callable/Trace.hpp"
+
+struct Listener
+{
+	int Sum = 0;
+	void OnEvent( int a_Value ) { Sum += a_Value; }
+};
+
+// Measure broadcasting and invoking with tracing disabled and enabled, and flushing the recorded events. Compile with
+// -DCALLABLE_TRACING=0 for the cost with tracing compiled out.
+int main()
+{
+	static constexpr size_t Listeners = 16;
+	static constexpr size_t Broadcasts = 1000;
+	static constexpr size_t Invocations = 1 << 20;
+
+	std::vector< Listener > Targets( Listeners );
+	Delegate< void, int > Event;
+	Event.SetName( "Event" );
+
+	for ( Listener& Target : Targets )
+	{
+		Event.Add< &Listener::OnEvent >( &Target );
+	}
+
+	Invoker< void, int > Single;
+	Single.Bind< &Listener::OnEvent >( Targets[ 0 ] );
+
+	Benchmark::Report( "16 listeners, tracing disabled, broadcast", Benchmark::Measure( Broadcasts, [&]( size_t i ) { Event( static_cast< int >( i ) ); } ) );
+	Benchmark::Report( "invoker, tracing disabled, invoke", Benchmark::Measure( Invocations, [&]( size_t i ) { Single( static_cast< int >( i ) ); } ) );
+
+	Tracer::Enable();
+
+	// Fewer broadcasts than fit in the thread's buffer, so that no events are dropped.
+	Benchmark::Report( "16 listeners, tracing enabled, broadcast", Benchmark::Measure( Broadcasts, [&]( size_t i ) { Event( static_cast< int >( i ) ); } ) );
+
+	std::string Trace;
+	Benchmark::Report( "16 listeners, tracing enabled, flush 1000 broadcasts", Benchmark::Measure( 1, [&]( size_t ) { Trace = Tracer::Flush(); } ) );
+
+	Benchmark::Report( "invoker, tracing enabled, invoke", Benchmark::Measure( Broadcasts, [&]( size_t i ) { Single( static_cast< int >( i ) ); } ) );
+
+	Tracer::Disable();
+	Tracer::Flush();
+
+	int Sum = static_cast< int >( Trace.size() );
+	for ( const Listener& Target : Targets )
+	{
+		Sum += Target.Sum;
+	}
+	Benchmark::DoNotOptimise( Sum );
+	return 0;
+}
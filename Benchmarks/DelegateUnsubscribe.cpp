@@ -0,0 +1,71 @@
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../Callable/Delegate.hpp"
+
+struct Listener
+{
+	int Count = 0;
+	void OnEvent() { ++Count; }
+};
+
+struct StableHandleTraits : StableDelegateTraits
+{
+	static constexpr bool Handles = true;
+};
+
+int main()
+{
+	static constexpr size_t Listeners = 10000;
+	static constexpr size_t Churn = 1 << 14;
+
+	std::vector< Listener > Targets( Listeners );
+	std::vector< DelegateHandle > Handles( Listeners );
+	HandleDelegate< void > Event;
+
+	for ( size_t i = 0; i < Listeners; ++i )
+	{
+		Handles[ i ] = Event.Add< &Listener::OnEvent >( &Targets[ i ] );
+	}
+
+	// Each iteration unsubscribes one listener and subscribes it again, as a churning subscriber would.
+	size_t Next = 0;
+	Benchmark::Report( "10000 listeners, remove by member function", Benchmark::Measure( Churn, [&]( size_t )
+	{
+		Next = ( Next + 7919 ) % Listeners;
+		Event.Remove< &Listener::OnEvent >( &Targets[ Next ] );
+		Handles[ Next ] = Event.Add< &Listener::OnEvent >( &Targets[ Next ] );
+	} ) );
+
+	Benchmark::Report( "10000 listeners, remove by handle", Benchmark::Measure( Churn, [&]( size_t )
+	{
+		Next = ( Next + 7919 ) % Listeners;
+		Event.Remove( Handles[ Next ] );
+		Handles[ Next ] = Event.Add< &Listener::OnEvent >( &Targets[ Next ] );
+	} ) );
+
+	// Removal leaves a tombstone, compacted once half of the list is tombstones.
+	BasicDelegate< StableHandleTraits, void > Ordered;
+
+	for ( size_t i = 0; i < Listeners; ++i )
+	{
+		Handles[ i ] = Ordered.Add< &Listener::OnEvent >( &Targets[ i ] );
+	}
+
+	Benchmark::Report( "10000 listeners, stable order, remove by handle", Benchmark::Measure( Churn, [&]( size_t )
+	{
+		Next = ( Next + 7919 ) % Listeners;
+		Ordered.Remove( Handles[ Next ] );
+		Handles[ Next ] = Ordered.Add< &Listener::OnEvent >( &Targets[ Next ] );
+	} ) );
+
+	Event();
+	Ordered();
+
+	int Sum = 0;
+	for ( const Listener& Target : Targets )
+	{
+		Sum += Target.Count;
+	}
+	Benchmark::DoNotOptimise( Sum );
+}
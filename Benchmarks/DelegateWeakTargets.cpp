@@ -0,0 +1,46 @@
+#include <memory>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../Callable/Delegate.hpp"
+
+struct Listener
+{
+	int Count = 0;
+	void OnEvent() { ++Count; }
+};
+
+int main()
+{
+	static constexpr size_t Listeners = 10000;
+	static constexpr size_t Broadcasts = 1000;
+
+	std::vector< std::shared_ptr< Listener > > Targets;
+	Delegate< void > Strong;
+	WeakDelegate< void > Weak;
+
+	for ( size_t i = 0; i < Listeners; ++i )
+	{
+		Targets.push_back( std::make_shared< Listener >() );
+		Strong.Add< &Listener::OnEvent >( Targets.back().get() );
+		Weak.Add< &Listener::OnEvent >( Targets.back() );
+	}
+
+	Benchmark::Report( "10000 listeners, broadcast", Benchmark::Measure( Broadcasts, [&]( size_t ) { Strong(); } ) );
+	Benchmark::Report( "10000 listeners, weak, broadcast", Benchmark::Measure( Broadcasts, [&]( size_t ) { Weak(); } ) );
+
+	// Tearing down every listener, each removing itself as its destructor would, against one broadcast purging them all.
+	Benchmark::Report( "10000 listeners, teardown by remove", Benchmark::Measure( 1, [&]( size_t )
+	{
+		for ( size_t i = 0; i < Listeners; ++i )
+		{
+			Strong.Remove< &Listener::OnEvent >( Targets[ i ].get() );
+		}
+	} ) );
+
+	Targets.clear();
+
+	Benchmark::Report( "10000 listeners, weak, teardown by broadcast", Benchmark::Measure( 1, [&]( size_t ) { Weak(); } ) );
+
+	Benchmark::DoNotOptimise( Strong.Size() + Weak.Size() );
+}
@@ -0,0 +1,57 @@
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../Callable/EventQueue.hpp"
+
+struct Listener
+{
+	float Sum = 0.0f;
+	void OnDamage( int a_Target, float a_Amount ) { Sum += a_Target * a_Amount; }
+};
+
+int main()
+{
+	static constexpr size_t Listeners = 8;
+	static constexpr size_t Events = 1024;
+	static constexpr size_t Passes = 2000;
+
+	Listener Targets[ Listeners ];
+	Delegate< void, int, float > Damage;
+
+	for ( Listener& Target : Targets )
+	{
+		Damage.Add< &Listener::OnDamage >( &Target );
+	}
+
+	EventQueue< Delegate< void, int, float > > Queue( Damage, Events );
+
+	// Results are per event.
+	Benchmark::Result Immediate = Benchmark::Measure( Passes, [&]( size_t )
+	{
+		for ( size_t i = 0; i < Events; ++i )
+		{
+			Damage( static_cast< int >( i ), 0.5f );
+		}
+	} );
+	Immediate.NanosecondsPerOp /= Events;
+	Benchmark::Report( "1024 events, 8 listeners, immediate broadcast", Immediate );
+
+	Benchmark::Result Enqueue = Benchmark::Measure( Passes, [&]( size_t )
+	{
+		for ( size_t i = 0; i < Events; ++i )
+		{
+			Queue.Enqueue( static_cast< int >( i ), 0.5f );
+		}
+
+		Queue.Drain();
+	} );
+	Enqueue.NanosecondsPerOp /= Events;
+	Benchmark::Report( "1024 events, 8 listeners, enqueue and drain", Enqueue );
+
+	float Sum = 0.0f;
+	for ( const Listener& Target : Targets )
+	{
+		Sum += Target.Sum;
+	}
+	Benchmark::DoNotOptimise( Sum );
+}
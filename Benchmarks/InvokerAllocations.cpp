@@ -0,0 +1,61 @@
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../Callable/Delegate.hpp"
+
+// Invoker with inline storage disabled, matching the previous always-heap behaviour.
+template < typename Return, typename... Args >
+using HeapInvoker = BasicInvoker< InvokerStorage< 0 >, Return, Args... >;
+
+template < typename InvokerType >
+void Run( const char* a_Name )
+{
+	static constexpr size_t Iterations = 1000000;
+
+	int Value = 1;
+	int* Pointer = &Value;
+	std::vector< InvokerType > Invokers( Iterations );
+	char Name[ 128 ];
+
+	std::snprintf( Name, sizeof( Name ), "%s bind (1 pointer capture)", a_Name );
+	Benchmark::Report( Name, Benchmark::Measure( Iterations, [&]( size_t i ) { Invokers[ i ] = [Pointer]( int a ) { return *Pointer + a; }; } ) );
+
+	std::vector< InvokerType > Copies( Iterations );
+
+	std::snprintf( Name, sizeof( Name ), "%s copy", a_Name );
+	Benchmark::Report( Name, Benchmark::Measure( Iterations, [&]( size_t i ) { Copies[ i ] = Invokers[ i ]; } ) );
+
+	std::snprintf( Name, sizeof( Name ), "%s bind (2 pointer capture)", a_Name );
+	Benchmark::Report( Name, Benchmark::Measure( Iterations, [&]( size_t i ) { Invokers[ i ] = [Pointer, i]( int a ) { return *Pointer + a + ( int )i; }; } ) );
+
+	std::snprintf( Name, sizeof( Name ), "%s invoke", a_Name );
+	Benchmark::Report( Name, Benchmark::Measure( Iterations, [&]( size_t i ) { Benchmark::DoNotOptimise( Invokers[ i ]( 1 ) ); } ) );
+
+	std::snprintf( Name, sizeof( Name ), "%s destroy", a_Name );
+	Benchmark::Report( Name, Benchmark::Measure( Iterations, [&]( size_t i ) { Invokers[ i ] = nullptr; Copies[ i ] = nullptr; } ) );
+}
+
+// Adding lambdas to a delegate, whose invokers keep small callables inline.
+void RunDelegate()
+{
+	static constexpr size_t Iterations = 1000000;
+
+	int Value = 1;
+	int* Pointer = &Value;
+
+	Delegate< void, int > Growing;
+	Benchmark::Report( "Delegate add (1 pointer capture)", Benchmark::Measure( Iterations, [&]( size_t ) { Growing.Add( [Pointer]( int a ) { *Pointer += a; } ); } ) );
+
+	Delegate< void, int > Reserved;
+	Reserved.Reserve( 2 * Iterations );
+	Benchmark::Report( "Delegate add reserved (1 pointer capture)", Benchmark::Measure( Iterations, [&]( size_t ) { Reserved.Add( [Pointer]( int a ) { *Pointer += a; } ); } ) );
+	Benchmark::Report( "Delegate add reserved (2 pointer capture)", Benchmark::Measure( Iterations, [&]( size_t i ) { Reserved.Add( [Pointer, i]( int a ) { *Pointer += a + ( int )i; } ); } ) );
+}
+
+int main()
+{
+	Run< HeapInvoker< int, int > >( "Heap" );
+	Run< Invoker< int, int > >( "Inline" );
+	RunDelegate();
+	return 0;
+}
@@ -0,0 +1,62 @@
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../Callable/Invoker.hpp"
+
+// A listener large enough that each instance occupies its own cache lines.
+struct Target
+{
+	uint64_t Padding[ 32 ];
+	int OnEvent( int a_Value ) { return a_Value + ( int )Padding[ 0 ]; }
+};
+
+static constexpr size_t TargetCount = 1 << 18;
+
+// Touch a buffer larger than the last level cache so that targets are cold.
+static void EvictCaches()
+{
+	static std::vector< uint8_t > Buffer( 64 << 20 );
+
+	for ( size_t i = 0; i < Buffer.size(); i += 64 )
+	{
+		++Buffer[ i ];
+	}
+
+	Benchmark::DoNotOptimise( Buffer );
+}
+
+int main()
+{
+	std::vector< Target > Targets( TargetCount );
+	std::vector< size_t > Order( TargetCount );
+	std::iota( Order.begin(), Order.end(), 0 );
+	std::shuffle( Order.begin(), Order.end(), std::mt19937{ 42 } );
+
+	std::vector< Invoker< int, int > > Invokers;
+	Invokers.reserve( TargetCount );
+
+	for ( size_t i = 0; i < TargetCount; ++i )
+	{
+		Invokers.emplace_back( &Targets[ Order[ i ] ], MemberFunction< &Target::OnEvent >{} );
+	}
+
+	std::vector< Invoker< int, int > > Copies( TargetCount );
+
+	// Reading the first word of each target is what the previous tag based ownership check did on every copy and destroy.
+	EvictCaches();
+	uint64_t Sum = 0;
+	Benchmark::Report( "read first word of cold target (previous check)", Benchmark::Measure( TargetCount, [&]( size_t i ) { Sum += *( uint64_t* )&Targets[ Order[ i ] ]; } ) );
+	Benchmark::DoNotOptimise( Sum );
+
+	EvictCaches();
+	Benchmark::Report( "copy reference invoker (cold target)", Benchmark::Measure( TargetCount, [&]( size_t i ) { Copies[ i ] = Invokers[ i ]; } ) );
+
+	EvictCaches();
+	Benchmark::Report( "destroy reference invoker (cold target)", Benchmark::Measure( TargetCount, [&]( size_t i ) { Copies[ i ] = nullptr; } ) );
+
+	return 0;
+}
@@ -0,0 +1,99 @@
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../Callable/Invoker.hpp"
+
+struct Listener
+{
+	int Offset;
+	int OnEvent( int a_Value ) { return a_Value + Offset; }
+};
+
+static int StaticListener( int a_Value ) { return a_Value * 3; }
+
+// A member function bound with raw pointers, the baseline for member bindings.
+struct MemberPointer
+{
+	Listener* Object;
+	int ( Listener::*Function )( int );
+
+	int operator()( int a_Value ) const { return ( Object->*Function )( a_Value ); }
+};
+
+// Measure binding, copying, moving, invoking and destroying one callable type. a_Bind( Callable, Index ) binds a callable in
+// place, and copying is skipped for move only types.
+template < typename T, typename Bind >
+void Run( const char* a_Type, const char* a_Binding, Bind&& a_Bind )
+{
+	static constexpr size_t Iterations = 1 << 20;
+
+	std::vector< T > Bound( Iterations );
+	std::vector< T > Copies( Iterations );
+	std::vector< T > Moved( Iterations );
+	char Name[ 128 ];
+
+	std::snprintf( Name, sizeof( Name ), "%s, %s, bind", a_Type, a_Binding );
+	Benchmark::Report( Name, Benchmark::Measure( Iterations, [&]( size_t i ) { a_Bind( Bound[ i ], i ); } ) );
+
+	if constexpr ( std::is_copy_assignable_v< T > )
+	{
+		std::snprintf( Name, sizeof( Name ), "%s, %s, copy", a_Type, a_Binding );
+		Benchmark::Report( Name, Benchmark::Measure( Iterations, [&]( size_t i ) { Copies[ i ] = Bound[ i ]; } ) );
+	}
+
+	std::snprintf( Name, sizeof( Name ), "%s, %s, move", a_Type, a_Binding );
+	Benchmark::Report( Name, Benchmark::Measure( Iterations, [&]( size_t i ) { Moved[ i ] = std::move( Bound[ i ] ); } ) );
+
+	int Sum = 0;
+	std::snprintf( Name, sizeof( Name ), "%s, %s, invoke", a_Type, a_Binding );
+	Benchmark::Report( Name, Benchmark::Measure( Iterations, [&]( size_t i ) { Sum += Moved[ i ]( static_cast< int >( i ) ); } ) );
+	Benchmark::DoNotOptimise( Sum );
+
+	std::snprintf( Name, sizeof( Name ), "%s, %s, destroy", a_Type, a_Binding );
+	Benchmark::Report( Name, Benchmark::Measure( Iterations, [&]( size_t i ) { Moved[ i ] = T(); } ) );
+}
+
+// Measure a type erased callable with static, member and capturing lambda bindings. Types other than Invoker bind members
+// through a lambda capturing the object.
+template < typename T >
+void RunErased( const char* a_Type, std::vector< Listener >& a_Listeners )
+{
+	Run< T >( a_Type, "static", []( T& a_Callable, size_t ) { a_Callable = StaticListener; } );
+
+	if constexpr ( std::is_same_v< T, Invoker< int, int > > )
+	{
+		Run< T >( a_Type, "member", [&]( T& a_Callable, size_t i ) { a_Callable.template Bind< &Listener::OnEvent >( a_Listeners[ i ] ); } );
+	}
+	else
+	{
+		Run< T >( a_Type, "member", [&]( T& a_Callable, size_t i ) { Listener* Target = &a_Listeners[ i ]; a_Callable = [Target]( int a_Value ) { return Target->OnEvent( a_Value ); }; } );
+	}
+
+	// Captures 24 bytes, past the small buffer of the Invoker and of libstdc++ std::function.
+	Run< T >( a_Type, "capture lambda", [&]( T& a_Callable, size_t i )
+	{
+		Listener* Target = &a_Listeners[ i ];
+		size_t Scale = i & 7;
+		int Bias = static_cast< int >( i >> 3 );
+		a_Callable = [Target, Scale, Bias]( int a_Value ) { return Target->OnEvent( a_Value * static_cast< int >( Scale ) ) + Bias; };
+	} );
+}
+
+int main()
+{
+	std::vector< Listener > Listeners( 1 << 20, Listener{ 1 } );
+
+	Run< int ( * )( int ) >( "function pointer", "static", []( int ( *&a_Callable )( int ), size_t ) { a_Callable = StaticListener; } );
+	Run< MemberPointer >( "member function pointer", "member", [&]( MemberPointer& a_Callable, size_t i ) { a_Callable = { &Listeners[ i ], &Listener::OnEvent }; } );
+
+	RunErased< Invoker< int, int > >( "Invoker", Listeners );
+	RunErased< std::function< int( int ) > >( "std::function", Listeners );
+
+#if defined( __cpp_lib_move_only_function )
+	RunErased< std::move_only_function< int( int ) > >( "std::move_only_function", Listeners );
+#endif
+
+	return 0;
+}
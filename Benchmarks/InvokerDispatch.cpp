@@ -0,0 +1,63 @@
+#include <random>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "../Callable/Invoker.hpp"
+
+// Dispatch as it was before the uniform thunk: a branch on the object pointer picks the calling convention.
+struct BranchingInvoker
+{
+	void* Object;
+	void* Function;
+
+	int Invoke( int a_Value ) const
+	{
+		return Object ?
+			reinterpret_cast< int( * )( void*, int ) >( Function )( Object, a_Value ) :
+			reinterpret_cast< int( * )( int ) >( Function )( a_Value );
+	}
+};
+
+struct Listener
+{
+	int Offset;
+	int OnEvent( int a_Value ) { return a_Value + Offset; }
+};
+
+static int StaticListener( int a_Value ) { return a_Value * 3; }
+
+static int MemberThunk( void* a_Object, int a_Value ) { return static_cast< Listener* >( a_Object )->OnEvent( a_Value ); }
+
+int main()
+{
+	static constexpr size_t Count = 1 << 16;
+	static constexpr size_t Passes = 64;
+
+	// Randomly interleave static and member bindings so that the calling convention branch is unpredictable.
+	std::mt19937 Random{ 42 };
+	std::bernoulli_distribution IsStatic{ 0.5 };
+	std::vector< Listener > Listeners( Count, Listener{ 1 } );
+	std::vector< BranchingInvoker > Before( Count );
+	std::vector< Invoker< int, int > > After( Count );
+
+	for ( size_t i = 0; i < Count; ++i )
+	{
+		if ( IsStatic( Random ) )
+		{
+			Before[ i ] = { nullptr, reinterpret_cast< void* >( StaticListener ) };
+			After[ i ] = StaticListener;
+		}
+		else
+		{
+			Before[ i ] = { &Listeners[ i ], reinterpret_cast< void* >( MemberThunk ) };
+			After[ i ].Bind< &Listener::OnEvent >( &Listeners[ i ] );
+		}
+	}
+
+	int Sum = 0;
+	Benchmark::Report( "mixed static/member, branching dispatch", Benchmark::Measure( Count * Passes, [&]( size_t i ) { Sum += Before[ i % Count ].Invoke( ( int )i ); } ) );
+	Benchmark::Report( "mixed static/member, uniform thunk", Benchmark::Measure( Count * Passes, [&]( size_t i ) { Sum += After[ i % Count ].Invoke( ( int )i ); } ) );
+	Benchmark::DoNotOptimise( Sum );
+
+	return 0;
+}
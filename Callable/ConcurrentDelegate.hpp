@@ -0,0 +1,420 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+
+#include "Delegate.hpp"
+
+// Helpers for concurrent delegate types.
+namespace ConcurrentHelpers
+{
+    // Reader state of one thread in the epoch domain. Records are never freed, the record of an exited thread is reused by the next
+    // thread that registers.
+    struct EpochRecord
+    {
+        // Epoch the thread entered its outermost read section in, or zero when not reading.
+        std::atomic< uint64_t > Epoch{ 0 };
+        std::atomic< bool >     IsUsed{ false };
+        EpochRecord*            Next = nullptr;
+
+        // Nesting depth of read sections, only accessed by the owning thread.
+        uint32_t Depth = 0;
+    };
+
+    // Epoch based reclamation shared by all concurrent delegates. Readers publish the epoch they started reading in, and memory
+    // retired in an epoch is reclaimed once every reader has moved past it.
+    struct EpochDomain
+    {
+        std::atomic< uint64_t >      Epoch{ 1 };
+        std::atomic< EpochRecord* > Records{ nullptr };
+
+        // Claim a free record, or add a new one.
+        EpochRecord* Acquire()
+        {
+            for ( EpochRecord* Record = Records.load( std::memory_order_acquire ); Record; Record = Record->Next )
+            {
+                bool IsUsed = false;
+
+                if ( !Record->IsUsed.load( std::memory_order_relaxed ) && Record->IsUsed.compare_exchange_strong( IsUsed, true, std::memory_order_acquire ) )
+                {
+                    return Record;
+                }
+            }
+
+            EpochRecord* Record = new EpochRecord;
+            Record->IsUsed.store( true, std::memory_order_relaxed );
+            Record->Next = Records.load( std::memory_order_relaxed );
+
+            while ( !Records.compare_exchange_weak( Record->Next, Record, std::memory_order_release, std::memory_order_relaxed ) );
+
+            return Record;
+        }
+
+        // Get the oldest epoch any thread is currently reading in. Memory retired before it can no longer be reached by readers.
+        uint64_t GetOldestEpoch() const
+        {
+            uint64_t Oldest = std::numeric_limits< uint64_t >::max();
+
+            for ( EpochRecord* Record = Records.load( std::memory_order_acquire ); Record; Record = Record->Next )
+            {
+                uint64_t Epoch = Record->Epoch.load( std::memory_order_seq_cst );
+
+                if ( Epoch != 0 && Epoch < Oldest )
+                {
+                    Oldest = Epoch;
+                }
+            }
+
+            return Oldest;
+        }
+    };
+
+    inline EpochDomain& GetEpochDomain()
+    {
+        static EpochDomain Domain;
+        return Domain;
+    }
+
+    // Registration of the calling thread with the epoch domain, released when the thread exits.
+    struct ThreadRecord
+    {
+        ThreadRecord() : Record( GetEpochDomain().Acquire() ) {}
+        ~ThreadRecord() { Record->IsUsed.store( false, std::memory_order_release ); }
+
+        EpochRecord* Record;
+    };
+
+    inline EpochRecord& GetThreadRecord()
+    {
+        thread_local ThreadRecord Thread;
+        return *Thread.Record;
+    }
+
+    // Marks the calling thread as reading snapshots for the guard's lifetime. Guards may be nested.
+    class EpochGuard
+    {
+    public:
+
+        EpochGuard()
+            : m_Record( GetThreadRecord() )
+        {
+            if ( m_Record.Depth++ == 0 )
+            {
+                m_Record.Epoch.store( GetEpochDomain().Epoch.load( std::memory_order_seq_cst ), std::memory_order_relaxed );
+                std::atomic_thread_fence( std::memory_order_seq_cst );
+            }
+        }
+
+        ~EpochGuard()
+        {
+            if ( --m_Record.Depth == 0 )
+            {
+                m_Record.Epoch.store( 0, std::memory_order_release );
+            }
+        }
+
+        EpochGuard( const EpochGuard& ) = delete;
+        EpochGuard& operator=( const EpochGuard& ) = delete;
+
+    private:
+
+        EpochRecord& m_Record;
+    };
+}
+
+template < typename _Traits, typename Return, typename... Args >
+class BasicConcurrentDelegate;
+
+template < typename Return = void, typename... Args >
+using ConcurrentDelegate = BasicConcurrentDelegate< DelegateTraits, Return, Args... >;
+
+//==========================================================================
+// A concurrent delegate can be broadcast from any number of threads while
+// others add and remove invokers. Broadcasting reads an immutable snapshot
+// of the invocation list without locking. Adding and removing copy the
+// current snapshot, publish the modified copy, and retire the old one to be
+// reclaimed once no broadcast can still be reading it. Writers are
+// serialised by a mutex. Retired snapshots are reclaimed by the next
+// modification, by the last broadcast reading them as it returns, or by
+// Reclaim. Removed callables are destroyed when their snapshot is
+// reclaimed, which may happen on another thread.
+//==========================================================================
+template < typename _Traits, typename Return, typename... Args >
+class BasicConcurrentDelegate
+{
+private:
+
+    using InvokerType = BasicInvoker< typename _Traits::StorageType, Return, Args... >;
+    using AllocatorType = typename std::allocator_traits< typename _Traits::StorageType::AllocatorType >::template rebind_alloc< InvokerType >;
+    using ContainerType = std::vector< InvokerType, AllocatorType >;
+
+    static_assert( _Traits::StorageType::Copyable, "Concurrent delegates copy their invokers into each new snapshot." );
+
+    // Only the storage of the traits is used. Traits that would change how a delegate stores, orders or calls its invokers are not
+    // implemented for snapshots, so they are rejected rather than ignored.
+    static_assert( !_Traits::StructureOfArrays && !_Traits::BatchDispatch && !_Traits::StableOrder && !_Traits::Priorities && !_Traits::ParallelBroadcast,
+                   "Concurrent delegates neither keep the order of their invokers nor prioritise them, and call them on the broadcasting thread." );
+    static_assert( !_Traits::Handles && !_Traits::HashIndex && !_Traits::ObjectIndex && !_Traits::WeakTargets,
+                   "Concurrent delegates neither return handles nor index or weaken their invokers." );
+    static_assert( !_Traits::Instrumented, "Concurrent delegates are not instrumented." );
+    static_assert( _Traits::Reentrancy == DelegateReentrancy::Drop, "Concurrent delegates always recurse into broadcasts started by listeners, so Reentrancy must be left at its default." );
+
+    // An immutable invocation list, and its link in the list of retired snapshots.
+    struct Snapshot
+    {
+        explicit Snapshot( const AllocatorType& a_Allocator ) : Invokers( a_Allocator ) {}
+        explicit Snapshot( const ContainerType& a_Invokers ) : Invokers( a_Invokers, a_Invokers.get_allocator() ) {}
+
+        ContainerType Invokers;
+        Snapshot*     Retired = nullptr;
+        uint64_t      Epoch = 0;
+    };
+
+public:
+
+    // Create an empty concurrent delegate.
+    BasicConcurrentDelegate()
+        : BasicConcurrentDelegate( AllocatorType() )
+    {}
+
+    // Create an empty concurrent delegate that allocates its snapshots and stored callables with the given allocator.
+    explicit BasicConcurrentDelegate( const AllocatorType& a_Allocator )
+        : m_Allocator( a_Allocator )
+        , m_Current( InvokerHelpers::AllocateObject< Snapshot >( m_Allocator, m_Allocator ) )
+        , m_Retired( nullptr )
+        , m_HasRetired( false )
+        , m_Name( nullptr )
+    {}
+
+    BasicConcurrentDelegate( const BasicConcurrentDelegate& ) = delete;
+    BasicConcurrentDelegate& operator=( const BasicConcurrentDelegate& ) = delete;
+
+    // Destroy the delegate. No thread may be broadcasting it.
+    ~BasicConcurrentDelegate()
+    {
+        InvokerHelpers::DeallocateObject( m_Allocator, m_Current.load( std::memory_order_relaxed ) );
+
+        while ( m_Retired )
+        {
+            Snapshot* Next = m_Retired->Retired;
+            InvokerHelpers::DeallocateObject( m_Allocator, m_Retired );
+            m_Retired = Next;
+        }
+    }
+
+    // Add a functor or function to the delegate.
+    template < typename T >
+    void Add( T&& a_Function )
+    {
+        Modify( [&]( ContainerType& a_Invokers ) { a_Invokers.emplace_back( std::forward< T >( a_Function ) ); return true; } );
+    }
+
+    // Add an instance and member function to the delegate.
+    template < auto _Function, typename Object >
+    void Add( Object* a_Object, MemberFunction< _Function > a_Function = MemberFunction< _Function >{} )
+    {
+        Modify( [&]( ContainerType& a_Invokers ) { a_Invokers.emplace_back( a_Object, a_Function ); return true; } );
+    }
+
+    // Remove a functor or function from the delegate.
+    template < typename T >
+    void Remove( T&& a_Function )
+    {
+        Modify( [&]( ContainerType& a_Invokers ) { return Erase( a_Invokers, a_Function ); } );
+    }
+
+    // Remove an instance and member function from the delegate.
+    template < auto _Function, typename Object >
+    void Remove( Object* a_Object, MemberFunction< _Function > a_Function = MemberFunction< _Function >{} )
+    {
+        Modify( [&]( ContainerType& a_Invokers ) { return Erase( a_Invokers, InvokerType( a_Object, a_Function ) ); } );
+    }
+
+    // Remove all invokers from the delegate.
+    void Clear()
+    {
+        Modify( []( ContainerType& a_Invokers ) { a_Invokers.clear(); return true; } );
+    }
+
+    // Call all invokers of the current snapshot with the given arguments. Invokers added or removed during the broadcast, by this
+    // or any other thread, take effect from the next broadcast. On return, frees retired snapshots no other broadcast is reading,
+    // unless a writer holds the lock and will free them itself.
+    void Broadcast( InvokerHelpers::ParameterType< Args >... a_Args ) const
+    {
+        {
+            ConcurrentHelpers::EpochGuard Guard;
+            const Snapshot* Current = m_Current.load( std::memory_order_acquire );
+
+#if CALLABLE_TRACING
+            if ( Tracer::IsEnabled() )
+            {
+                BroadcastTraced( Current->Invokers, std::forward< InvokerHelpers::ParameterType< Args > >( a_Args )... );
+            }
+            else
+#endif
+            {
+                for ( const InvokerType& Invoker : Current->Invokers )
+                {
+                    ( void )Invoker.InvokeUntraced( std::forward< InvokerHelpers::ParameterType< Args > >( a_Args )... );
+                }
+            }
+        }
+
+        if ( m_HasRetired.load( std::memory_order_relaxed ) )
+        {
+            std::unique_lock< std::mutex > Lock( m_Mutex, std::try_to_lock );
+
+            if ( Lock.owns_lock() )
+            {
+                ReclaimRetired();
+            }
+        }
+    }
+
+    // Call all invokers of the current snapshot with the given arguments.
+    void operator()( InvokerHelpers::ParameterType< Args >... a_Args ) const
+    {
+        Broadcast( std::forward< InvokerHelpers::ParameterType< Args > >( a_Args )... );
+    }
+
+    // The count of stored invokers in the current snapshot.
+    size_t Size() const
+    {
+        ConcurrentHelpers::EpochGuard Guard;
+        return m_Current.load( std::memory_order_acquire )->Invokers.size();
+    }
+
+    // Is the current snapshot empty?
+    bool Empty() const { return Size() == 0; }
+
+    // Name the delegate in trace events. The name is not copied, so it must outlive the delegate and any trace flushed after it,
+    // as a string literal does.
+    void SetName( const char* a_Name ) { m_Name.store( a_Name, std::memory_order_relaxed ); }
+
+    // Get the name of the delegate in trace events, or null if it has none.
+    const char* GetName() const { return m_Name.load( std::memory_order_relaxed ); }
+
+    // Get the allocator used for snapshots.
+    AllocatorType GetAllocator() const { return m_Allocator; }
+
+    // Free retired snapshots that no broadcast can still be reading, and return how many were freed. Only needed to release
+    // removed callables promptly once the delegate is neither modified nor broadcast any more.
+    size_t Reclaim()
+    {
+        std::lock_guard< std::mutex > Lock( m_Mutex );
+        return ReclaimRetired();
+    }
+
+    // Add a functor or function object to the delegate.
+    template < typename T >
+    inline BasicConcurrentDelegate& operator+=( T&& a_Function ) { Add( std::forward< T >( a_Function ) ); return *this; }
+
+    // Remove a functor or function object from the delegate.
+    template < typename T >
+    inline BasicConcurrentDelegate& operator-=( T&& a_Function ) { Remove( std::forward< T >( a_Function ) ); return *this; }
+
+private:
+
+    // Remove the first invoker matching a_Function, replacing it with the last invoker.
+    template < typename T >
+    static bool Erase( ContainerType& a_Invokers, const T& a_Function )
+    {
+        auto Found = std::find( a_Invokers.begin(), a_Invokers.end(), a_Function );
+
+        if ( Found == a_Invokers.end() )
+        {
+            return false;
+        }
+
+        *Found = std::move( a_Invokers.back() );
+        a_Invokers.pop_back();
+        return true;
+    }
+
+#if CALLABLE_TRACING
+    // Call every invoker of a snapshot, tracing the broadcast and each call as a listener of the delegate, as Delegate does.
+    void BroadcastTraced( const ContainerType& a_Invokers, InvokerHelpers::ParameterType< Args >... a_Args ) const
+    {
+        const char* Name = GetName();
+        const Tracer::Scope Scope( TraceHelpers::EventKind::Broadcast, Name, 0, nullptr );
+
+        for ( size_t i = 0; i < a_Invokers.size(); ++i )
+        {
+            const Tracer::Scope Listener( TraceHelpers::EventKind::Listener, Name, i, a_Invokers[ i ].GetTraceSymbol() );
+            ( void )a_Invokers[ i ].InvokeUntraced( std::forward< InvokerHelpers::ParameterType< Args > >( a_Args )... );
+        }
+    }
+#endif
+
+    // Apply a_Modify to a copy of the current snapshot and publish it if a_Modify returns true.
+    template < typename Function >
+    void Modify( Function&& a_Modify )
+    {
+        std::lock_guard< std::mutex > Lock( m_Mutex );
+
+        Snapshot* Current = m_Current.load( std::memory_order_relaxed );
+        Snapshot* Next = InvokerHelpers::AllocateObject< Snapshot >( m_Allocator, Current->Invokers );
+
+        bool IsModified;
+
+        try
+        {
+            IsModified = a_Modify( Next->Invokers );
+        }
+        catch ( ... )
+        {
+            InvokerHelpers::DeallocateObject( m_Allocator, Next );
+            throw;
+        }
+
+        if ( !IsModified )
+        {
+            InvokerHelpers::DeallocateObject( m_Allocator, Next );
+            return;
+        }
+
+        m_Current.store( Next, std::memory_order_release );
+        std::atomic_thread_fence( std::memory_order_seq_cst );
+
+        // Readers that can still see Current entered at or before this epoch.
+        Current->Epoch = ConcurrentHelpers::GetEpochDomain().Epoch.fetch_add( 1, std::memory_order_seq_cst );
+        Current->Retired = m_Retired;
+        m_Retired = Current;
+
+        ReclaimRetired();
+    }
+
+    // Free retired snapshots that no reader can still be reading, and return how many were freed. Requires the lock.
+    size_t ReclaimRetired() const
+    {
+        uint64_t Oldest = ConcurrentHelpers::GetEpochDomain().GetOldestEpoch();
+        size_t Count = 0;
+
+        for ( Snapshot** Link = &m_Retired; *Link; )
+        {
+            Snapshot* Retired = *Link;
+
+            if ( Retired->Epoch < Oldest )
+            {
+                *Link = Retired->Retired;
+                InvokerHelpers::DeallocateObject( m_Allocator, Retired );
+                ++Count;
+            }
+            else
+            {
+                Link = &Retired->Retired;
+            }
+        }
+
+        m_HasRetired.store( m_Retired != nullptr, std::memory_order_relaxed );
+        return Count;
+    }
+
+    AllocatorType               m_Allocator;
+    std::atomic< Snapshot* >    m_Current;
+    mutable Snapshot*           m_Retired;
+    mutable std::atomic< bool > m_HasRetired;
+    mutable std::mutex          m_Mutex;
+    std::atomic< const char* >  m_Name;
+};
@@ -1,18 +1,391 @@
 #pragma once
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <tuple>
+#include <unordered_map>
 #include <vector>
 
 #include "Invoker.hpp"
 
-template < typename Return, typename... Args >
-class Delegate;
+// Delegates can be awaited by C++20 coroutines when the compiler supports them.
+#if defined( __cpp_impl_coroutine ) && __has_include( <coroutine> )
+#define CALLABLE_COROUTINES 1
+#include <coroutine>
+#include <optional>
+#else
+#define CALLABLE_COROUTINES 0
+#endif
+
+// Results of a broadcast can be collected into a std::span when the standard library provides one.
+#if __cplusplus >= 202002L && __has_include( <span> )
+#define CALLABLE_SPAN 1
+#include <span>
+#else
+#define CALLABLE_SPAN 0
+#endif
+
+// How a delegate handles a broadcast started by one of its listeners while it is broadcasting.
+enum class DelegateReentrancy : uint8_t
+{
+    // Ignore the nested broadcast.
+    Drop,
+
+    // Broadcast to every invoker, then continue the outer broadcast where it left off.
+    Recurse,
+
+    // Store the nested broadcast's arguments, and broadcast them once the outer broadcast has finished, before it returns.
+    Queue
+};
+
+// Counts of broadcasts started while a delegate was already broadcasting, by how they were handled.
+struct DelegateReentrancyCounters
+{
+    uint64_t Dropped = 0;
+    uint64_t Recursed = 0;
+    uint64_t Queued = 0;
+};
+
+// Configuration for a delegate. Derive from this and override members to customise a BasicDelegate.
+struct DelegateTraits
+{
+    // Storage used by the delegate's invokers. Its allocator is also used for the invocation list. Invokers keep their address for
+    // as long as they are in the invocation list, so callables stored inline stay put when listeners add to the delegate while it
+    // is being called.
+    using StorageType = InvokerStorage<>;
+
+    // Broadcast from dense arrays of thunk and object pointers kept alongside the invokers, instead of from the invokers themselves.
+    // Costs two pointers of memory per invoker and upkeep on every add and remove.
+    static constexpr bool StructureOfArrays = false;
+
+    // Call runs of adjacent invokers bound to the same member function through one batch thunk, which loops over their objects and
+    // calls the member function directly. Requires StructureOfArrays.
+    static constexpr bool BatchDispatch = false;
+
+    // Keep invokers in the order they were added. Removing an invoker unbinds it and leaves a tombstone in its place, and the
+    // invocation list is compacted by the first add or remove after the outermost broadcast, or once more than half of it is
+    // tombstones. Otherwise the last invoker is moved into the removed invoker's place.
+    static constexpr bool StableOrder = false;
+
+    // Handling of broadcasts started by listeners during a broadcast.
+    static constexpr DelegateReentrancy Reentrancy = DelegateReentrancy::Drop;
+
+    // Keep an index of invokers by their bound object, so that RemoveObject only visits the object's invokers instead of the whole
+    // invocation list. Costs a hash map entry per invoker and upkeep on every add and remove.
+    static constexpr bool ObjectIndex = false;
+
+    // Keep a hash index of invokers by their bound object and function, so that AddUnique, Remove and RemoveAll with a function,
+    // invoker or object and member function find invokers in constant time on average instead of searching the invocation list.
+    // Costs a hash map entry per invoker and upkeep on every add and remove.
+    static constexpr bool HashIndex = false;
+
+    // Allow invokers bound to objects owned by a std::shared_ptr, or to a lifetime token, without keeping them alive. Invokers whose
+    // target has been destroyed are skipped, and removed in one pass by the first add or remove after the broadcast that finds them.
+    // Costs a std::weak_ptr per weak invoker and a flag test per call.
+    static constexpr bool WeakTargets = false;
+
+    // Count calls to each invoker and to the delegate, with their total time, and keep histograms of the latencies of broadcasts and
+    // of all calls, read with GetStatistics. Costs two clock reads per call, 16 bytes of counters per invoker and two 2 KB histograms
+    // per delegate, and disables batching. Broadcasting to 10000 listeners takes about 1 ms instead of 30 us, most of it reading
+    // the clock.
+    static constexpr bool Instrumented = false;
+
+    // Keep a histogram of the latencies of each invoker's calls as well, when Instrumented. Costs 2 KB of counters per invoker, which
+    // a snapshot copies. With 10000 listeners a broadcast takes about 1.5 ms instead of 1 ms, and a snapshot 12 ms instead of 5 ms.
+    static constexpr bool ListenerLatencies = true;
+
+    // Return handles from Add, which find their invoker without searching for Remove, Contains, IndexOf and Subscribe. Costs a slot
+    // per invoker and upkeep on every add and remove. Implied by HashIndex, ObjectIndex, WeakTargets and Instrumented, which keep
+    // their entries by slot. Otherwise Add returns an invalid handle.
+    static constexpr bool Handles = false;
+
+    // Allow invokers to be added with a DelegatePriority. Costs a priority per invoker. Adding an invoker ahead of invokers of lower
+    // priority shifts them all if the delegate keeps its order, and otherwise reorders invokers of equal priority.
+    static constexpr bool Priorities = false;
+
+    // Allow invokers added with AddParallel to be called on a thread pool by BroadcastParallel and CollectParallel. Costs a byte of
+    // flags per invoker, which delegates that keep their order or have weak invokers already store.
+    static constexpr bool ParallelBroadcast = false;
+};
+
+// Delegate configuration that broadcasts from dense arrays of thunk and object pointers.
+struct SoaDelegateTraits : DelegateTraits
+{
+    static constexpr bool StructureOfArrays = true;
+};
+
+// Delegate configuration that also batches runs of invokers bound to the same member function, for delegates with many instances
+// of one listener type.
+struct BatchDelegateTraits : SoaDelegateTraits
+{
+    static constexpr bool BatchDispatch = true;
+};
+
+// Delegate configuration that keeps invokers in the order they were added when others are removed.
+struct StableDelegateTraits : DelegateTraits
+{
+    static constexpr bool StableOrder = true;
+};
+
+// Delegate configuration that indexes invokers by hash, for delegates with many listeners that are added uniquely or removed by
+// callable.
+struct HashedDelegateTraits : DelegateTraits
+{
+    static constexpr bool HashIndex = true;
+};
+
+// Delegate configuration that indexes invokers by their bound object, for delegates whose listeners are removed by object in bulk.
+struct ObjectDelegateTraits : DelegateTraits
+{
+    static constexpr bool ObjectIndex = true;
+};
+
+// Delegate configuration for listeners that may be destroyed without removing themselves.
+struct WeakDelegateTraits : DelegateTraits
+{
+    static constexpr bool WeakTargets = true;
+};
+
+// Delegate configuration that records how often and how long its listeners are called.
+struct InstrumentedDelegateTraits : DelegateTraits
+{
+    static constexpr bool Instrumented = true;
+};
+
+// Delegate configuration that returns handles to remove invokers with.
+struct HandleDelegateTraits : DelegateTraits
+{
+    static constexpr bool Handles = true;
+};
+
+// Delegate configuration that calls invokers in priority order.
+struct PriorityDelegateTraits : DelegateTraits
+{
+    static constexpr bool Priorities = true;
+};
+
+// Delegate configuration that calls parallel safe invokers on a thread pool.
+struct ParallelDelegateTraits : DelegateTraits
+{
+    static constexpr bool ParallelBroadcast = true;
+};
+
+// Delegate configuration that allocates invokers and the invocation list from a std::pmr::memory_resource.
+struct PmrDelegateTraits : DelegateTraits
+{
+    using StorageType = PmrInvokerStorage;
+};
+
+// Delegate configuration for move-only invokers, allowing move-only callables to be added.
+struct UniqueDelegateTraits : DelegateTraits
+{
+    using StorageType = UniqueInvokerStorage;
+};
+
+// Identifies an invoker added to a delegate. Handles stay valid while other invokers are added and removed, and become invalid
+// once their invoker is removed or the delegate is cleared.
+struct DelegateHandle
+{
+    uint32_t Slot = UINT32_MAX;
+    uint32_t Generation = 0;
+
+    // Does the handle refer to an invoker? The invoker may since have been removed.
+    explicit operator bool() const { return Slot != UINT32_MAX; }
+
+    bool operator==( const DelegateHandle& a_Other ) const { return Slot == a_Other.Slot && Generation == a_Other.Generation; }
+    bool operator!=( const DelegateHandle& a_Other ) const { return !( *this == a_Other ); }
+};
+
+// Priority of an invoker in a delegate. Invokers of higher priority are called first.
+struct DelegatePriority
+{
+    explicit constexpr DelegatePriority( int32_t a_Value = 0 ) : Value( a_Value ) {}
+
+    int32_t Value;
+};
+
+// Histogram of latencies in nanoseconds, in the manner of HDR histograms. Values below 8 have a bucket each, and every power of two
+// above is split into 8 linear buckets, so a value is within 12.5% of its bucket's lower bound. Values of 2^36 ns or more, about 69
+// seconds, are counted in the last bucket.
+struct DelegateLatencyHistogram
+{
+    static constexpr uint32_t SubBucketBits = 3;
+    static constexpr uint32_t SubBuckets = 1 << SubBucketBits;
+    static constexpr uint32_t MaxExponent = 35;
+    static constexpr uint32_t BucketCount = ( MaxExponent - SubBucketBits + 2 ) * SubBuckets;
+
+    // Get the bucket counting the given latency.
+    static constexpr uint32_t BucketOf( uint64_t a_Nanoseconds )
+    {
+        if ( a_Nanoseconds < SubBuckets )
+        {
+            return static_cast< uint32_t >( a_Nanoseconds );
+        }
+
+        // Find the highest set bit by halving the width searched.
+        uint32_t Exponent = 0;
+        uint64_t Value = a_Nanoseconds;
+
+        for ( uint32_t Shift = 32; Shift; Shift >>= 1 )
+        {
+            if ( Value >> Shift )
+            {
+                Value >>= Shift;
+                Exponent += Shift;
+            }
+        }
+
+        if ( Exponent > MaxExponent )
+        {
+            return BucketCount - 1;
+        }
+
+        return ( Exponent - SubBucketBits + 1 ) * SubBuckets + static_cast< uint32_t >( ( a_Nanoseconds >> ( Exponent - SubBucketBits ) ) & ( SubBuckets - 1 ) );
+    }
+
+    // Get the lowest latency counted in the given bucket.
+    static constexpr uint64_t LowerBound( uint32_t a_Bucket )
+    {
+        if ( a_Bucket < SubBuckets )
+        {
+            return a_Bucket;
+        }
+
+        return static_cast< uint64_t >( SubBuckets + a_Bucket % SubBuckets ) << ( a_Bucket / SubBuckets - 1 );
+    }
+
+    // Get the count of recorded latencies.
+    uint64_t TotalCount() const
+    {
+        uint64_t Total = 0;
+
+        for ( uint64_t Count : Counts )
+        {
+            Total += Count;
+        }
+
+        return Total;
+    }
+
+    // Get the lower bound of the bucket holding the given quantile, between 0 and 1, of the recorded latencies. Returns 0 if none
+    // were recorded.
+    uint64_t Quantile( double a_Quantile ) const
+    {
+        const uint64_t Total = TotalCount();
+
+        if ( Total == 0 )
+        {
+            return 0;
+        }
+
+        const uint64_t Rank = std::min( static_cast< uint64_t >( a_Quantile * static_cast< double >( Total ) ), Total - 1 );
+        uint64_t Seen = 0;
+
+        for ( uint32_t i = 0; i < BucketCount; ++i )
+        {
+            Seen += Counts[ i ];
+
+            if ( Seen > Rank )
+            {
+                return LowerBound( i );
+            }
+        }
+
+        return 0;
+    }
+
+    uint64_t Counts[ BucketCount ] = {};
+};
+
+// Count and total time of calls recorded by an instrumented delegate.
+struct DelegateCallCounts
+{
+    uint64_t Calls = 0;
+    uint64_t Nanoseconds = 0;
+};
+
+// Counts of calls recorded by an instrumented delegate, with a histogram of their latencies.
+struct DelegateCallStatistics : DelegateCallCounts
+{
+    DelegateLatencyHistogram Latency;
+};
+
+// Calls to one invoker of an instrumented delegate, at the given index of its invocation list. Latencies are only counted if the
+// delegate's traits keep ListenerLatencies.
+struct DelegateListenerStatistics : DelegateCallStatistics
+{
+    DelegateHandle Handle;
+    size_t         Index = 0;
+};
+
+// Snapshot of an instrumented delegate's statistics. Broadcasts times whole outermost broadcasts, Calls every call to an invoker,
+// and Listeners holds an entry per invoker in invocation list order.
+struct DelegateStatistics
+{
+    DelegateCallStatistics                    Broadcasts;
+    DelegateCallStatistics                    Calls;
+    std::vector< DelegateListenerStatistics > Listeners;
+};
+
+template < typename _Traits, typename Return, typename... Args >
+class BasicDelegate;
+
+template < typename _Delegate >
+class ScopedSubscription;
+
+template < typename Return = void, typename... Args >
+using Delegate = BasicDelegate< DelegateTraits, Return, Args... >;
+
+template < typename Return = void, typename... Args >
+using PmrDelegate = BasicDelegate< PmrDelegateTraits, Return, Args... >;
+
+template < typename Return = void, typename... Args >
+using UniqueDelegate = BasicDelegate< UniqueDelegateTraits, Return, Args... >;
+
+template < typename Return = void, typename... Args >
+using SoaDelegate = BasicDelegate< SoaDelegateTraits, Return, Args... >;
+
+template < typename Return = void, typename... Args >
+using BatchDelegate = BasicDelegate< BatchDelegateTraits, Return, Args... >;
+
+template < typename Return = void, typename... Args >
+using StableDelegate = BasicDelegate< StableDelegateTraits, Return, Args... >;
+
+template < typename Return = void, typename... Args >
+using HashedDelegate = BasicDelegate< HashedDelegateTraits, Return, Args... >;
+
+template < typename Return = void, typename... Args >
+using WeakDelegate = BasicDelegate< WeakDelegateTraits, Return, Args... >;
+
+template < typename Return = void, typename... Args >
+using ObjectDelegate = BasicDelegate< ObjectDelegateTraits, Return, Args... >;
+
+template < typename Return = void, typename... Args >
+using InstrumentedDelegate = BasicDelegate< InstrumentedDelegateTraits, Return, Args... >;
+
+template < typename Return = void, typename... Args >
+using HandleDelegate = BasicDelegate< HandleDelegateTraits, Return, Args... >;
+
+template < typename Return = void, typename... Args >
+using PriorityDelegate = BasicDelegate< PriorityDelegateTraits, Return, Args... >;
+
+template < typename Return = void, typename... Args >
+using ParallelDelegate = BasicDelegate< ParallelDelegateTraits, Return, Args... >;
+
+// A PredicateDelegate is a delegate of predicates, which can be queried with AnyOf and AllOf.
+template < typename... Args >
+using PredicateDelegate = Delegate< bool, Args... >;
 
 namespace std
 {
     template < typename T >
     struct is_delegate : public std::false_type {};
 
-    template < typename Return, typename... Args >
-    struct is_delegate< Invoker< Return, Args... > > : public std::true_type {};
+    template < typename _Traits, typename Return, typename... Args >
+    struct is_delegate< BasicDelegate< _Traits, Return, Args... > > : public std::true_type {};
 
     template < typename T >
     static constexpr bool is_delegate_v = is_delegate< T >::value;
@@ -26,374 +399,3094 @@ namespace std
     template < typename Return, typename... Args >
     struct as_delegate< Return( Args... ) > { using type = Delegate< Return, Args... >; };
 
-    template < typename Return, typename... Args >
-    struct as_delegate< Delegate< Return, Args... > > { using type = Delegate< Return, Args... >; };
+    template < typename _Traits, typename Return, typename... Args >
+    struct as_delegate< BasicDelegate< _Traits, Return, Args... > > { using type = BasicDelegate< _Traits, Return, Args... >; };
 
     template < typename T >
     using as_delegate_t = typename as_delegate< T >::type;
 }
 
-//==========================================================================
-// Delegates are a collection of stored invokers.
-//==========================================================================
-template < typename Return = void, typename... Args >
-class Delegate
+// Helpers for delegate types.
+namespace DelegateHelpers
 {
-private:
+    // Per invoker flags stored by a delegate.
+    enum InvokerFlag : uint8_t
+    {
+        // The invoker may be called concurrently with other parallel safe invokers of the delegate, and from any thread.
+        ParallelSafe = 1 << 0,
+
+        // The invoker has been removed from a delegate that keeps its order, and is unbound until the list is compacted.
+        Tombstone = 1 << 1,
+
+        // The invoker's target is kept alive elsewhere, and the invoker expires with the lifetime stored for its slot.
+        Weak = 1 << 2
+    };
+
+    // Thunk and object pointers of a delegate's invokers, stored as two dense arrays so that broadcasting streams through them
+    // without touching the invokers. The invokers still own their callables, and are the delegate's invocation list.
+    // Batched delegates also record the length of the run of identical thunks starting at each invoker, and the batch thunk to
+    // call for it. Batch thunks are only known for member functions added through the delegate, so they are kept in a registry
+    // keyed by the invocation thunk they replace.
+    template < typename _Function, typename _Batch, typename _Allocator, bool _Enabled >
+    struct DispatchTable
+    {
+        template < typename T >
+        using AllocatorType = typename std::allocator_traits< _Allocator >::template rebind_alloc< T >;
+
+        explicit DispatchTable( const _Allocator& a_Allocator )
+            : Functions( AllocatorType< _Function >( a_Allocator ) )
+            , Objects( AllocatorType< void* >( a_Allocator ) )
+            , Runs( AllocatorType< uint32_t >( a_Allocator ) )
+            , Batches( AllocatorType< _Batch >( a_Allocator ) )
+            , Registry( AllocatorType< std::pair< _Function, _Batch > >( a_Allocator ) )
+            , Version( 0 )
+            , IsDirty( false )
+            , IsRunsDirty( false )
+        {}
+
+        std::vector< _Function, AllocatorType< _Function > > Functions;
+        std::vector< void*, AllocatorType< void* > >         Objects;
+
+        std::vector< uint32_t, AllocatorType< uint32_t > >                                 Runs;
+        std::vector< _Batch, AllocatorType< _Batch > >                                     Batches;
+        std::vector< std::pair< _Function, _Batch >, AllocatorType< std::pair< _Function, _Batch > > > Registry;
+
+        // Incremented whenever the table changes, so that a batch can stop when a listener modifies the delegate.
+        uint32_t Version;
+
+        // Set when invokers may have been modified through a mutable reference, the table is rebuilt before the next broadcast.
+        bool IsDirty;
+
+        // Set when the runs need to be rebuilt before the next broadcast.
+        bool IsRunsDirty;
+    };
+
+    template < typename _Function, typename _Batch, typename _Allocator >
+    struct DispatchTable< _Function, _Batch, _Allocator, false >
+    {
+        explicit DispatchTable( const _Allocator& ) {}
+    };
 
-    using InvokerType = Invoker< Return, Args... >;
-    using ReturnType = Return;
-    using ArgumentTypes = std::tuple< Args... >;
-    using ContainerType = std::vector< Invoker< Return, Args... > >;
-    using IteratorType = typename ContainerType::iterator;
-    using CIteratorType = typename ContainerType::const_iterator;
-    using RIteratorType = typename ContainerType::reverse_iterator;
-    using CRIteratorType = typename ContainerType::const_reverse_iterator;
+    // Arguments of broadcasts queued by listeners until the outer broadcast finishes. The storage is kept between broadcasts, so
+    // queueing only allocates when more broadcasts are queued at once than before.
+    template < typename _Event, typename _Allocator, bool _Enabled >
+    struct PendingQueue
+    {
+        using AllocatorType = typename std::allocator_traits< _Allocator >::template rebind_alloc< _Event >;
+
+        explicit PendingQueue( const _Allocator& a_Allocator ) : Events( AllocatorType( a_Allocator ) ) {}
+
+        std::vector< _Event, AllocatorType > Events;
+    };
+
+    template < typename _Event, typename _Allocator >
+    struct PendingQueue< _Event, _Allocator, false >
+    {
+        explicit PendingQueue( const _Allocator& ) {}
+    };
+
+    // Cursor of a broadcast interrupted by a recursive broadcast, linked from the delegate through the stack frames of the nested
+    // broadcasts so that adding and removing invokers can move every cursor.
+    struct CursorFrame
+    {
+        int32_t      Index;
+        bool         IsRemoved;
+        CursorFrame* Outer;
+    };
+
+    // Slots of indexed invokers by a key, the hash of their bound object and function or their bound object. Slots stay the same
+    // when invokers move within the invocation list, so only adding and removing invokers updates the index.
+    template < typename _Key, typename _Allocator, bool _Enabled >
+    struct InvokerLookup
+    {
+        using AllocatorType = typename std::allocator_traits< _Allocator >::template rebind_alloc< std::pair< const _Key, uint32_t > >;
+
+        explicit InvokerLookup( const _Allocator& a_Allocator ) : Entries( 0, std::hash< _Key >(), std::equal_to< _Key >(), AllocatorType( a_Allocator ) ) {}
+
+        // Remove the entry of the given slot.
+        void Erase( const _Key& a_Key, uint32_t a_Slot )
+        {
+            auto Range = Entries.equal_range( a_Key );
+
+            for ( auto Entry = Range.first; Entry != Range.second; ++Entry )
+            {
+                if ( Entry->second == a_Slot )
+                {
+                    Entries.erase( Entry );
+                    return;
+                }
+            }
+        }
+
+        std::unordered_multimap< _Key, uint32_t, std::hash< _Key >, std::equal_to< _Key >, AllocatorType > Entries;
+    };
+
+    template < typename _Key, typename _Allocator >
+    struct InvokerLookup< _Key, _Allocator, false >
+    {
+        explicit InvokerLookup( const _Allocator& ) {}
+    };
+
+    // Lifetimes of the targets of weak invokers, by slot, so that they stay put when invokers move within the invocation list.
+    template < typename _Allocator, bool _Enabled >
+    struct LifetimeTable
+    {
+        using AllocatorType = typename std::allocator_traits< _Allocator >::template rebind_alloc< std::weak_ptr< const void > >;
+
+        explicit LifetimeTable( const _Allocator& a_Allocator ) : Targets( AllocatorType( a_Allocator ) ), HasExpired( false ) {}
+
+        std::vector< std::weak_ptr< const void >, AllocatorType > Targets;
+
+        // Set when a broadcast skipped an expired invoker, which is removed by the next add or remove.
+        bool HasExpired;
+    };
+
+    template < typename _Allocator >
+    struct LifetimeTable< _Allocator, false >
+    {
+        explicit LifetimeTable( const _Allocator& ) {}
+    };
+
+    // Increment a counter that has one writer at a time, without a read-modify-write. Counters are relaxed atomics so that they can
+    // be read while calls are being recorded.
+    inline void Increment( std::atomic< uint64_t >& a_Counter, uint64_t a_Value )
+    {
+        a_Counter.store( a_Counter.load( std::memory_order_relaxed ) + a_Value, std::memory_order_relaxed );
+    }
+
+    // Count and total time of calls to one invoker, whose only writer is the thread calling it.
+    struct CallCounters
+    {
+        CallCounters() { Reset(); }
+
+        void Record( uint64_t a_Nanoseconds )
+        {
+            Increment( Calls, 1 );
+            Increment( Nanoseconds, a_Nanoseconds );
+        }
+
+        void Reset()
+        {
+            Calls.store( 0, std::memory_order_relaxed );
+            Nanoseconds.store( 0, std::memory_order_relaxed );
+        }
+
+        void Load( DelegateCallCounts& a_Counts ) const
+        {
+            a_Counts.Calls = Calls.load( std::memory_order_relaxed );
+            a_Counts.Nanoseconds = Nanoseconds.load( std::memory_order_relaxed );
+        }
+
+        std::atomic< uint64_t > Calls;
+        std::atomic< uint64_t > Nanoseconds;
+    };
+
+    // Counts of calls with a histogram of their latencies, of one invoker or of every invoker of a delegate. _Concurrent counters,
+    // shared by invokers called in parallel, record with read-modify-writes.
+    template < bool _Concurrent >
+    struct LatencyCounters : CallCounters
+    {
+        LatencyCounters() { Reset(); }
+
+        void Record( uint64_t a_Nanoseconds )
+        {
+            std::atomic< uint64_t >& Bucket = Buckets[ DelegateLatencyHistogram::BucketOf( a_Nanoseconds ) ];
+
+            if constexpr ( _Concurrent )
+            {
+                Calls.fetch_add( 1, std::memory_order_relaxed );
+                Nanoseconds.fetch_add( a_Nanoseconds, std::memory_order_relaxed );
+                Bucket.fetch_add( 1, std::memory_order_relaxed );
+            }
+            else
+            {
+                CallCounters::Record( a_Nanoseconds );
+                Increment( Bucket, 1 );
+            }
+        }
+
+        void Reset()
+        {
+            CallCounters::Reset();
+
+            for ( std::atomic< uint64_t >& Bucket : Buckets )
+            {
+                Bucket.store( 0, std::memory_order_relaxed );
+            }
+        }
+
+        void Load( DelegateCallStatistics& a_Statistics ) const
+        {
+            CallCounters::Load( a_Statistics );
+
+            for ( uint32_t i = 0; i < DelegateLatencyHistogram::BucketCount; ++i )
+            {
+                a_Statistics.Latency.Counts[ i ] = Buckets[ i ].load( std::memory_order_relaxed );
+            }
+        }
+
+        std::atomic< uint64_t > Buckets[ DelegateLatencyHistogram::BucketCount ];
+    };
+
+    // Call counters of an instrumented delegate: latencies of its broadcasts and of all its calls, and counters for each invoker by
+    // slot, so that they stay put when invokers move within the invocation list. The invokers' counters, with a histogram of their
+    // latencies if _Latencies, are kept in a deque, which does not move them as it grows. An invoker is called by one thread at a
+    // time, so its histogram has one writer.
+    template < typename _Allocator, bool _Enabled, bool _Concurrent, bool _Latencies >
+    struct Instrumentation
+    {
+        using ListenerType = std::conditional_t< _Latencies, LatencyCounters< false >, CallCounters >;
+        using AllocatorType = typename std::allocator_traits< _Allocator >::template rebind_alloc< ListenerType >;
+
+        // Records the time from its construction to its destruction as a call, in the given latencies and invoker's counters.
+        template < typename _Latency >
+        class Timer
+        {
+        public:
+
+            explicit Timer( _Latency& a_Latency, ListenerType* a_Counters = nullptr )
+                : m_Latency( a_Latency )
+                , m_Counters( a_Counters )
+                , m_Begin( std::chrono::steady_clock::now() )
+            {}
+
+            Timer( const Timer& ) = delete;
+            Timer& operator=( const Timer& ) = delete;
+
+            ~Timer()
+            {
+                const uint64_t Nanoseconds = static_cast< uint64_t >( std::chrono::duration_cast< std::chrono::nanoseconds >( std::chrono::steady_clock::now() - m_Begin ).count() );
+                m_Latency.Record( Nanoseconds );
+
+                if ( m_Counters )
+                {
+                    m_Counters->Record( Nanoseconds );
+                }
+            }
+
+        private:
+
+            _Latency&                             m_Latency;
+            ListenerType*                         m_Counters;
+            std::chrono::steady_clock::time_point m_Begin;
+        };
+
+        explicit Instrumentation( const _Allocator& a_Allocator ) : Listeners( AllocatorType( a_Allocator ) ) {}
+
+        // Count calls to the invoker with the given slot from zero.
+        void Track( uint32_t a_Slot )
+        {
+            while ( Listeners.size() <= a_Slot )
+            {
+                Listeners.emplace_back();
+            }
+
+            Listeners[ a_Slot ].Reset();
+        }
+
+        LatencyCounters< false >                  Broadcasts;
+        LatencyCounters< _Concurrent >            Calls;
+        std::deque< ListenerType, AllocatorType > Listeners;
+    };
+
+    template < typename _Allocator, bool _Concurrent, bool _Latencies >
+    struct Instrumentation< _Allocator, false, _Concurrent, _Latencies >
+    {
+        explicit Instrumentation( const _Allocator& ) {}
+    };
+
+    // Slots mapping delegate handles to the current index of their invoker. Each slot's generation is incremented when its invoker
+    // is removed, invalidating outstanding handles, and free slots are chained through their index into a free list.
+    template < typename _Allocator, bool _Enabled >
+    struct SlotMap
+    {
+        struct Entry
+        {
+            uint32_t Index;
+            uint32_t Generation;
+        };
+
+        using AllocatorType = typename std::allocator_traits< _Allocator >::template rebind_alloc< Entry >;
+
+        explicit SlotMap( const _Allocator& a_Allocator )
+            : Entries( AllocatorType( a_Allocator ) )
+            , FreeSlot( UINT32_MAX )
+        {}
+
+        // Take a free slot for the invoker at the given index.
+        uint32_t Acquire( size_t a_Index )
+        {
+            uint32_t Slot = FreeSlot;
+
+            if ( Slot == UINT32_MAX )
+            {
+                Slot = static_cast< uint32_t >( Entries.size() );
+                Entries.push_back( Entry{ 0, 0 } );
+            }
+            else
+            {
+                FreeSlot = Entries[ Slot ].Index;
+            }
+
+            Entries[ Slot ].Index = static_cast< uint32_t >( a_Index );
+            return Slot;
+        }
+
+        // Free a slot, invalidating its handles.
+        void Release( uint32_t a_Slot )
+        {
+            ++Entries[ a_Slot ].Generation;
+            Entries[ a_Slot ].Index = FreeSlot;
+            FreeSlot = a_Slot;
+        }
+
+        // Get the index of a handle's invoker, or UINT32_MAX if the handle is no longer valid.
+        uint32_t Find( DelegateHandle a_Handle ) const
+        {
+            return a_Handle.Slot < Entries.size() && Entries[ a_Handle.Slot ].Generation == a_Handle.Generation ? Entries[ a_Handle.Slot ].Index : UINT32_MAX;
+        }
+
+        // Free all slots.
+        void Clear()
+        {
+            Entries.clear();
+            FreeSlot = UINT32_MAX;
+        }
+
+        std::vector< Entry, AllocatorType > Entries;
+        uint32_t                            FreeSlot;
+    };
+
+    template < typename _Allocator >
+    struct SlotMap< _Allocator, false >
+    {
+        explicit SlotMap( const _Allocator& ) {}
+    };
+
+    // Type a listener must accept an argument of type T as. Move-only values are passed to every listener by rvalue reference, so
+    // a listener taking one by value or by rvalue reference would move from it before the listeners after it are called.
+    template < typename T >
+    using SharedParameterType = std::conditional_t< std::is_reference_v< T > || std::is_copy_constructible_v< T >, InvokerHelpers::ParameterType< T >, const T& >;
+
+    // Does a listener constructed from T... leave the delegate's move-only arguments to the listeners after it? Only callables and
+    // member functions are checked, the callables of bound invokers are not known.
+    template < typename _Arguments, typename... T >
+    struct SharesArguments : std::true_type {};
+
+    template < typename... Args, typename T >
+    struct SharesArguments< std::tuple< Args... >, T >
+        : std::bool_constant< std::is_invoker_v< T > || !std::is_invocable_v< T&, InvokerHelpers::ParameterType< Args >... > || std::is_invocable_v< T&, SharedParameterType< Args >... > > {};
+
+    template < typename... Args, auto _Function >
+    struct SharesArguments< std::tuple< Args... >, FreeFunction< _Function > >
+        : std::bool_constant< !std::is_invocable_v< decltype( _Function ), InvokerHelpers::ParameterType< Args >... > || std::is_invocable_v< decltype( _Function ), SharedParameterType< Args >... > > {};
+
+    template < typename... Args, typename Object, auto _Function >
+    struct SharesArguments< std::tuple< Args... >, Object*, MemberFunction< _Function > >
+        : std::bool_constant< !std::is_invocable_v< decltype( _Function ), Object*, InvokerHelpers::ParameterType< Args >... > || std::is_invocable_v< decltype( _Function ), Object*, SharedParameterType< Args >... > > {};
+
+    // Thunk of the last listener added to a delegate with move-only arguments that takes one by value or by rvalue reference. Such
+    // a listener can only be the delegate's only listener, so any invoker still bound to the thunk is that listener.
+    template < typename _Function, bool _Enabled >
+    struct Consumer
+    {
+        _Function Function = nullptr;
+    };
+
+    template < typename _Function >
+    struct Consumer< _Function, false >
+    {
+    };
+
+    // Stands in for the per invoker flags, priorities or slots of a delegate whose traits do not need them.
+    template < typename _Allocator >
+    struct NoValues
+    {
+        explicit NoValues( const _Allocator& ) {}
+        NoValues( const NoValues&, const _Allocator& ) {}
+    };
+
+    // Sequence whose elements keep their address for as long as they are in it. Elements are constructed in blocks that are never
+    // moved, and their order is kept as an array of pointers to them, so inserting and removing elements only shifts pointers.
+    // Blocks double in size as the sequence grows, and the nodes of removed elements are reused. The allocator is not propagated
+    // on assignment.
+    template < typename T, typename _Allocator >
+    class StableVector
+    {
+        union Node
+        {
+            Node*                      Next;
+            alignas( T ) unsigned char Data[ sizeof( T ) ];
+        };
+
+        struct Block
+        {
+            Node*  Nodes;
+            size_t Count;
+        };
+
+        template < typename U >
+        using AllocatorType = typename std::allocator_traits< _Allocator >::template rebind_alloc< U >;
+
+        using AllocatorTraits = std::allocator_traits< _Allocator >;
+        using NodeAllocatorTraits = std::allocator_traits< AllocatorType< Node > >;
+
+        template < bool _Const >
+        class Iterator
+        {
+        public:
+
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = T;
+            using difference_type = ptrdiff_t;
+            using pointer = std::conditional_t< _Const, const T*, T* >;
+            using reference = std::conditional_t< _Const, const T&, T& >;
+
+            Iterator() : m_Element( nullptr ) {}
+            explicit Iterator( T* const* a_Element ) : m_Element( a_Element ) {}
+
+            template < bool _Other, typename = std::enable_if_t< _Const && !_Other > >
+            Iterator( const Iterator< _Other >& a_Iterator ) : m_Element( a_Iterator.m_Element ) {}
+
+            reference operator*() const { return **m_Element; }
+            pointer operator->() const { return *m_Element; }
+            reference operator[]( difference_type a_Offset ) const { return *m_Element[ a_Offset ]; }
+
+            Iterator& operator++() { ++m_Element; return *this; }
+            Iterator& operator--() { --m_Element; return *this; }
+            Iterator operator++( int ) { return Iterator( m_Element++ ); }
+            Iterator operator--( int ) { return Iterator( m_Element-- ); }
+            Iterator& operator+=( difference_type a_Offset ) { m_Element += a_Offset; return *this; }
+            Iterator& operator-=( difference_type a_Offset ) { m_Element -= a_Offset; return *this; }
+
+            friend Iterator operator+( Iterator a_Iterator, difference_type a_Offset ) { return a_Iterator += a_Offset; }
+            friend Iterator operator+( difference_type a_Offset, Iterator a_Iterator ) { return a_Iterator += a_Offset; }
+            friend Iterator operator-( Iterator a_Iterator, difference_type a_Offset ) { return a_Iterator -= a_Offset; }
+            friend difference_type operator-( const Iterator& a_First, const Iterator& a_Second ) { return a_First.m_Element - a_Second.m_Element; }
+
+            friend bool operator==( const Iterator& a_First, const Iterator& a_Second ) { return a_First.m_Element == a_Second.m_Element; }
+            friend bool operator!=( const Iterator& a_First, const Iterator& a_Second ) { return a_First.m_Element != a_Second.m_Element; }
+            friend bool operator<( const Iterator& a_First, const Iterator& a_Second ) { return a_First.m_Element < a_Second.m_Element; }
+            friend bool operator>( const Iterator& a_First, const Iterator& a_Second ) { return a_First.m_Element > a_Second.m_Element; }
+            friend bool operator<=( const Iterator& a_First, const Iterator& a_Second ) { return a_First.m_Element <= a_Second.m_Element; }
+            friend bool operator>=( const Iterator& a_First, const Iterator& a_Second ) { return a_First.m_Element >= a_Second.m_Element; }
+
+        private:
+
+            template < bool >
+            friend class Iterator;
+
+            T* const* m_Element;
+        };
+
+    public:
+
+        using value_type = T;
+        using allocator_type = _Allocator;
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+        using reference = T&;
+        using const_reference = const T&;
+        using iterator = Iterator< false >;
+        using const_iterator = Iterator< true >;
+        using reverse_iterator = std::reverse_iterator< iterator >;
+        using const_reverse_iterator = std::reverse_iterator< const_iterator >;
+
+        explicit StableVector( const _Allocator& a_Allocator )
+            : m_Elements( AllocatorType< T* >( a_Allocator ) )
+            , m_Blocks( AllocatorType< Block >( a_Allocator ) )
+            , m_Free( nullptr )
+            , m_Capacity( 0 )
+        {}
+
+        StableVector( const StableVector& a_Other )
+            : StableVector( AllocatorTraits::select_on_container_copy_construction( a_Other.get_allocator() ) )
+        {
+            reserve( a_Other.size() );
+
+            for ( const T& Element : a_Other )
+            {
+                emplace( end(), Element );
+            }
+        }
+
+        StableVector( StableVector&& a_Other ) noexcept
+            : m_Elements( std::move( a_Other.m_Elements ) )
+            , m_Blocks( std::move( a_Other.m_Blocks ) )
+            , m_Free( a_Other.m_Free )
+            , m_Capacity( a_Other.m_Capacity )
+        {
+            a_Other.m_Elements.clear();
+            a_Other.m_Blocks.clear();
+            a_Other.m_Free = nullptr;
+            a_Other.m_Capacity = 0;
+        }
+
+        ~StableVector()
+        {
+            clear();
+            Deallocate();
+        }
+
+        StableVector& operator=( const StableVector& a_Other )
+        {
+            if ( this != &a_Other )
+            {
+                clear();
+                reserve( a_Other.size() );
+
+                for ( const T& Element : a_Other )
+                {
+                    emplace( end(), Element );
+                }
+            }
+
+            return *this;
+        }
+
+        // Takes over the other sequence's blocks if they can be released through this sequence's allocator, and otherwise moves its
+        // elements one by one.
+        StableVector& operator=( StableVector&& a_Other )
+        {
+            if ( this == &a_Other )
+            {
+                return *this;
+            }
+
+            clear();
+
+            if ( AllocatorTraits::is_always_equal::value || get_allocator() == a_Other.get_allocator() )
+            {
+                Deallocate();
+                m_Elements.swap( a_Other.m_Elements );
+                m_Blocks.swap( a_Other.m_Blocks );
+                std::swap( m_Free, a_Other.m_Free );
+                std::swap( m_Capacity, a_Other.m_Capacity );
+                return *this;
+            }
+
+            reserve( a_Other.size() );
+
+            for ( T& Element : a_Other )
+            {
+                emplace( end(), std::move( Element ) );
+            }
+
+            a_Other.clear();
+            return *this;
+        }
+
+        _Allocator get_allocator() const { return _Allocator( m_Elements.get_allocator() ); }
+
+        size_t size() const { return m_Elements.size(); }
+        bool empty() const { return m_Elements.empty(); }
+
+        T& operator[]( size_t a_Index ) { return *m_Elements[ a_Index ]; }
+        const T& operator[]( size_t a_Index ) const { return *m_Elements[ a_Index ]; }
+        T& back() { return *m_Elements.back(); }
+        const T& back() const { return *m_Elements.back(); }
+
+        iterator begin() { return iterator( m_Elements.data() ); }
+        const_iterator begin() const { return const_iterator( m_Elements.data() ); }
+        const_iterator cbegin() const { return begin(); }
+        iterator end() { return iterator( m_Elements.data() + m_Elements.size() ); }
+        const_iterator end() const { return const_iterator( m_Elements.data() + m_Elements.size() ); }
+        const_iterator cend() const { return end(); }
+        reverse_iterator rbegin() { return reverse_iterator( end() ); }
+        const_reverse_iterator rbegin() const { return const_reverse_iterator( end() ); }
+        const_reverse_iterator crbegin() const { return rbegin(); }
+        reverse_iterator rend() { return reverse_iterator( begin() ); }
+        const_reverse_iterator rend() const { return const_reverse_iterator( begin() ); }
+        const_reverse_iterator crend() const { return rend(); }
+
+        // Make room for a_Capacity elements, so that adding up to that many allocates nothing.
+        void reserve( size_t a_Capacity )
+        {
+            m_Elements.reserve( a_Capacity );
+
+            if ( a_Capacity > m_Capacity )
+            {
+                Grow( a_Capacity - m_Capacity );
+            }
+        }
+
+        template < typename... A >
+        iterator emplace( const_iterator a_Position, A&&... a_Args )
+        {
+            const ptrdiff_t Index = a_Position - cbegin();
+            Node* Free = Acquire();
+            T* Element = reinterpret_cast< T* >( Free->Data );
+
+            try
+            {
+                _Allocator Allocator( get_allocator() );
+                AllocatorTraits::construct( Allocator, Element, std::forward< A >( a_Args )... );
+            }
+            catch ( ... )
+            {
+                Free->Next = m_Free;
+                m_Free = Free;
+                throw;
+            }
+
+            try
+            {
+                m_Elements.insert( m_Elements.begin() + Index, Element );
+            }
+            catch ( ... )
+            {
+                Release( Element );
+                throw;
+            }
+
+            return begin() + Index;
+        }
+
+        iterator erase( const_iterator a_Position ) { return erase( a_Position, a_Position + 1 ); }
+
+        iterator erase( const_iterator a_First, const_iterator a_Last )
+        {
+            const ptrdiff_t First = a_First - cbegin();
+            const ptrdiff_t Last = a_Last - cbegin();
+
+            for ( ptrdiff_t i = First; i < Last; ++i )
+            {
+                Release( m_Elements[ i ] );
+            }
+
+            m_Elements.erase( m_Elements.begin() + First, m_Elements.begin() + Last );
+            return begin() + First;
+        }
+
+        void pop_back()
+        {
+            Release( m_Elements.back() );
+            m_Elements.pop_back();
+        }
+
+        void clear()
+        {
+            for ( T* Element : m_Elements )
+            {
+                Release( Element );
+            }
+
+            m_Elements.clear();
+        }
+
+        // Exchange the places of two elements, which stay where they are in memory.
+        void Swap( size_t a_First, size_t a_Second ) { std::swap( m_Elements[ a_First ], m_Elements[ a_Second ] ); }
+
+    private:
+
+        // Take a free node, allocating a block as large as every block so far if there are none.
+        Node* Acquire()
+        {
+            if ( !m_Free )
+            {
+                Grow( std::max< size_t >( m_Capacity, 8 ) );
+            }
+
+            Node* Free = m_Free;
+            m_Free = Free->Next;
+            return Free;
+        }
+
+        // Destroy an element, and free its node.
+        void Release( T* a_Element )
+        {
+            _Allocator Allocator( get_allocator() );
+            AllocatorTraits::destroy( Allocator, a_Element );
+
+            Node* Free = reinterpret_cast< Node* >( a_Element );
+            Free->Next = m_Free;
+            m_Free = Free;
+        }
+
+        // Allocate a block of a_Count free nodes, taken in address order.
+        void Grow( size_t a_Count )
+        {
+            AllocatorType< Node > Allocator( get_allocator() );
+            Node* Nodes = NodeAllocatorTraits::allocate( Allocator, a_Count );
+
+            try
+            {
+                m_Blocks.push_back( Block{ Nodes, a_Count } );
+            }
+            catch ( ... )
+            {
+                NodeAllocatorTraits::deallocate( Allocator, Nodes, a_Count );
+                throw;
+            }
+
+            for ( size_t i = a_Count; i-- > 0; )
+            {
+                Nodes[ i ].Next = m_Free;
+                m_Free = &Nodes[ i ];
+            }
+
+            m_Capacity += a_Count;
+        }
+
+        // Release every block. The sequence must be empty.
+        void Deallocate()
+        {
+            AllocatorType< Node > Allocator( get_allocator() );
+
+            for ( const Block& Allocated : m_Blocks )
+            {
+                NodeAllocatorTraits::deallocate( Allocator, Allocated.Nodes, Allocated.Count );
+            }
+
+            m_Blocks.clear();
+            m_Free = nullptr;
+            m_Capacity = 0;
+        }
+
+        std::vector< T*, AllocatorType< T* > >       m_Elements;
+        std::vector< Block, AllocatorType< Block > > m_Blocks;
+        Node*                                         m_Free;
+        size_t                                        m_Capacity;
+    };
+}
+
+//==========================================================================
+// Delegates are a collection of stored invokers. The invokers' storage and
+// the invocation list's allocator are configured by _Traits.
+//==========================================================================
+template < typename _Traits, typename Return, typename... Args >
+class BasicDelegate
+{
+private:
+
+    using InvokerType = BasicInvoker< typename _Traits::StorageType, Return, Args... >;
+    using ReturnType = Return;
+    using ArgumentTypes = std::tuple< Args... >;
+    using AllocatorType = typename std::allocator_traits< typename _Traits::StorageType::AllocatorType >::template rebind_alloc< InvokerType >;
+    using ContainerType = DelegateHelpers::StableVector< InvokerType, AllocatorType >;
+    using IteratorType = typename ContainerType::iterator;
+    using CIteratorType = typename ContainerType::const_iterator;
+    using RIteratorType = typename ContainerType::reverse_iterator;
+    using CRIteratorType = typename ContainerType::const_reverse_iterator;
+    using FunctionType = typename InvokerType::FunctionType;
+    using BatchFunctionType = void( * )( void* const*, int32_t&, int32_t, const uint32_t&, InvokerHelpers::ParameterType< Args >... );
+    using TableType = DelegateHelpers::DispatchTable< FunctionType, BatchFunctionType, AllocatorType, _Traits::StructureOfArrays >;
+
+    // Per invoker flags, priorities and slots are only kept for the traits that use them, so a plain delegate is its invocation list.
+    static constexpr bool HasFlags = _Traits::StableOrder || _Traits::WeakTargets || _Traits::ParallelBroadcast;
+    static constexpr bool HasPriorities = _Traits::Priorities;
+    static constexpr bool HasHandles = _Traits::Handles || _Traits::HashIndex || _Traits::ObjectIndex || _Traits::WeakTargets || _Traits::Instrumented;
+    static constexpr bool HasMoveOnlyArguments = ( ( !std::is_reference_v< Args > && !std::is_copy_constructible_v< Args > ) || ... );
+
+    using FlagContainerType = std::conditional_t< HasFlags, std::vector< uint8_t, typename std::allocator_traits< AllocatorType >::template rebind_alloc< uint8_t > >, DelegateHelpers::NoValues< AllocatorType > >;
+    using SlotContainerType = std::conditional_t< HasHandles, std::vector< uint32_t, typename std::allocator_traits< AllocatorType >::template rebind_alloc< uint32_t > >, DelegateHelpers::NoValues< AllocatorType > >;
+    using PriorityContainerType = std::conditional_t< HasPriorities, std::vector< int32_t, typename std::allocator_traits< AllocatorType >::template rebind_alloc< int32_t > >, DelegateHelpers::NoValues< AllocatorType > >;
+    using PendingQueueType = DelegateHelpers::PendingQueue< std::tuple< std::decay_t< Args >... >, AllocatorType, _Traits::Reentrancy == DelegateReentrancy::Queue >;
+    using SlotMapType = DelegateHelpers::SlotMap< AllocatorType, HasHandles >;
+    using LookupType = DelegateHelpers::InvokerLookup< size_t, AllocatorType, _Traits::HashIndex >;
+    using ObjectLookupType = DelegateHelpers::InvokerLookup< const void*, AllocatorType, _Traits::ObjectIndex >;
+    using LifetimeTableType = DelegateHelpers::LifetimeTable< AllocatorType, _Traits::WeakTargets >;
+    using InstrumentationType = DelegateHelpers::Instrumentation< AllocatorType, _Traits::Instrumented, _Traits::ParallelBroadcast, _Traits::ListenerLatencies >;
+    using ConsumerType = DelegateHelpers::Consumer< FunctionType, HasMoveOnlyArguments >;
+
+    // Instrumented delegates time each invoker, so runs of invokers are not batched.
+    static constexpr bool IsBatched = _Traits::BatchDispatch && !_Traits::Instrumented;
+    using StaticFunctionType = typename InvokerType::StaticFunctionType;
+
+    static_assert( !_Traits::BatchDispatch || _Traits::StructureOfArrays, "Batch dispatch requires the structure of arrays layout." );
+    static_assert( _Traits::Reentrancy != DelegateReentrancy::Queue || ( ( !std::is_lvalue_reference_v< Args > || std::is_const_v< std::remove_reference_t< Args > > ) && ... ), "Queued broadcasts copy their arguments, so they cannot be passed by non-const reference." );
+
+#if CALLABLE_COROUTINES
+    struct AwaiterListType;
+#endif
+
+public:
+
+#if CALLABLE_COROUTINES
+    // Arguments of a broadcast, as received by a coroutine awaiting the delegate.
+    using EventType = std::tuple< std::decay_t< Args >... >;
+
+    // Awaiter returned by Next. Lives in the awaiting coroutine's frame and is linked into the delegate's list of awaiters while
+    // suspended, so waiting never allocates.
+    class NextAwaiter
+    {
+    public:
+
+        explicit NextAwaiter( const BasicDelegate& a_Delegate )
+            : m_Delegate( &a_Delegate )
+            , m_List( nullptr )
+            , m_Previous( nullptr )
+            , m_Next( nullptr )
+        {}
+
+        NextAwaiter( const NextAwaiter& ) = delete;
+        NextAwaiter& operator=( const NextAwaiter& ) = delete;
+
+        // Unlink from the delegate if the awaiting coroutine is destroyed while suspended.
+        ~NextAwaiter()
+        {
+            if ( m_List )
+            {
+                m_List->Remove( *this );
+            }
+        }
+
+        bool await_ready() const noexcept { return false; }
+
+        void await_suspend( std::coroutine_handle<> a_Handle )
+        {
+            m_Handle = a_Handle;
+            m_Delegate->m_Awaiters.Append( *this );
+        }
+
+        EventType await_resume() { return std::move( *m_Event ); }
+
+    private:
+
+        friend class BasicDelegate;
+        friend struct AwaiterListType;
+
+        const BasicDelegate*       m_Delegate;
+        AwaiterListType*           m_List;
+        NextAwaiter*               m_Previous;
+        NextAwaiter*               m_Next;
+        std::coroutine_handle<>    m_Handle;
+        std::optional< EventType > m_Event;
+    };
+
+    // Suspend the awaiting coroutine until the next broadcast, and resume it with the broadcast's arguments as an EventType.
+    // Coroutines are resumed at the end of the broadcast, in the order they started waiting. Every broadcast resumes them: nested
+    // broadcasts recursed by listeners as they return, broadcasts queued by listeners after the one that queued them, each event of
+    // a batch, and parallel broadcasts once all invokers have returned. Dropped nested broadcasts do not. Coroutines waiting on a
+    // delegate when it is destroyed are never resumed.
+    NextAwaiter Next() const
+    {
+        static_assert( ( std::is_copy_constructible_v< std::decay_t< Args > > && ... ), "Awaited broadcast arguments are copied into the awaiter." );
+        return NextAwaiter( *this );
+    }
+#endif
+
+    // Create an empty delegate.
+    BasicDelegate()
+        : BasicDelegate( AllocatorType() )
+    {}
+
+    // Create an empty delegate that allocates its invocation list and stored callables with the given allocator.
+    explicit BasicDelegate( const AllocatorType& a_Allocator )
+        : m_Invokers( a_Allocator )
+        , m_Flags( a_Allocator )
+        , m_Priorities( a_Allocator )
+        , m_Slots( a_Allocator )
+        , m_SlotMap( a_Allocator )
+        , m_Lookup( a_Allocator )
+        , m_Objects( a_Allocator )
+        , m_Lifetimes( a_Allocator )
+        , m_Table( a_Allocator )
+        , m_Statistics( a_Allocator )
+        , m_Tombstones( 0 )
+        , m_IsCompactPending( false )
+        , m_Name( nullptr )
+        , m_Consumer()
+        , m_Pending( a_Allocator )
+        , m_IsBroadcasting( false )
+        , m_Index( -1 )
+        , m_IsCursorRemoved( false )
+        , m_Outer( nullptr )
+    {}
+
+    // Copies from a provided delegate.
+    BasicDelegate( const BasicDelegate& a_Delegate )
+        : m_Invokers( a_Delegate.m_Invokers )
+        , m_Flags( a_Delegate.m_Flags, m_Invokers.get_allocator() )
+        , m_Priorities( a_Delegate.m_Priorities, m_Invokers.get_allocator() )
+        , m_Slots( a_Delegate.m_Slots, m_Invokers.get_allocator() )
+        , m_SlotMap( a_Delegate.m_SlotMap )
+        , m_Lookup( m_Invokers.get_allocator() )
+        , m_Objects( m_Invokers.get_allocator() )
+        , m_Lifetimes( a_Delegate.m_Lifetimes )
+        , m_Table( m_Invokers.get_allocator() )
+        , m_Statistics( m_Invokers.get_allocator() )
+        , m_Tombstones( a_Delegate.m_Tombstones )
+        , m_IsCompactPending( a_Delegate.m_IsCompactPending )
+        , m_Name( a_Delegate.m_Name )
+        , m_Consumer( a_Delegate.m_Consumer )
+        , m_Pending( m_Invokers.get_allocator() )
+        , m_IsBroadcasting( false )
+        , m_Index( -1 )
+        , m_IsCursorRemoved( false )
+        , m_Outer( nullptr )
+    {
+        CopyRegistry( a_Delegate );
+        IndexAll();
+        ResetStatistics();
+        Synchronise( 0 );
+    }
+
+    // Moves from a provided delegate.
+    BasicDelegate( BasicDelegate&& a_Delegate )
+        : m_Invokers( std::move( a_Delegate.m_Invokers ) )
+        , m_Flags( std::move( a_Delegate.m_Flags ) )
+        , m_Priorities( std::move( a_Delegate.m_Priorities ) )
+        , m_Slots( std::move( a_Delegate.m_Slots ) )
+        , m_SlotMap( std::move( a_Delegate.m_SlotMap ) )
+        , m_Lookup( m_Invokers.get_allocator() )
+        , m_Objects( m_Invokers.get_allocator() )
+        , m_Lifetimes( std::move( a_Delegate.m_Lifetimes ) )
+        , m_Table( m_Invokers.get_allocator() )
+        , m_Statistics( m_Invokers.get_allocator() )
+        , m_Tombstones( a_Delegate.m_Tombstones )
+        , m_IsCompactPending( a_Delegate.m_IsCompactPending )
+        , m_Name( a_Delegate.m_Name )
+        , m_Consumer( a_Delegate.m_Consumer )
+        , m_Pending( m_Invokers.get_allocator() )
+        , m_IsBroadcasting( false )
+        , m_Index( -1 )
+        , m_IsCursorRemoved( false )
+        , m_Outer( nullptr )
+    {
+        CopyRegistry( a_Delegate );
+        a_Delegate.ResizeValues( a_Delegate.m_Invokers.size() );
+        a_Delegate.ResetSlots();
+        a_Delegate.m_Tombstones = 0;
+        IndexAll();
+        ResetStatistics();
+        Synchronise( 0 );
+        a_Delegate.Synchronise( 0 );
+        a_Delegate.m_Index = -1;
+    }
+
+#if CALLABLE_COROUTINES
+    // Destroy the delegate, abandoning coroutines still waiting on it.
+    ~BasicDelegate()
+    {
+        while ( m_Awaiters.Head )
+        {
+            m_Awaiters.Remove( *m_Awaiters.Head );
+        }
+    }
+#endif
+
+    // Add a functor or function to the delegate, after the invokers of the same or higher priority. Returns a handle to remove
+    // it with, or an invalid handle if the delegate's traits keep no handles. Every listener is passed the same move-only arguments,
+    // so a listener taking one by value or by rvalue reference is only added to an empty delegate, and nothing is added alongside
+    // it. Otherwise nothing is added, and an invalid handle is returned.
+    template < typename T >
+    DelegateHandle Add( T&& a_Function ) { return InsertPrioritised( 0, 0, std::forward< T >( a_Function ) ); }
+
+    // Add an instance and member function to the delegate, after the invokers of the same or higher priority. Returns a handle to
+    // remove it with, or an invalid handle if the delegate's traits keep no handles.
+    template < auto _Function, typename Object >
+    DelegateHandle Add( Object* a_Object, MemberFunction< _Function > a_Function = MemberFunction< _Function >{} )
+    {
+        Register< _Function >();
+        return InsertPrioritised( 0, 0, a_Object, a_Function );
+    }
+
+    // Add a functor or function to the delegate with the given priority. Invokers of higher priority are called first. Invokers
+    // of equal priority are called in the order they were added if the delegate keeps its order, and in no particular order
+    // otherwise: adding swaps the new invoker past the first invoker of each lower priority in use, which moves that invoker to the
+    // end of its priority. A delegate that keeps its order, or any delegate during a broadcast, shifts every invoker after the new
+    // one down instead, which takes time linear in the size of the invocation list.
+    template < typename T >
+    DelegateHandle Add( DelegatePriority a_Priority, T&& a_Function )
+    {
+        static_assert( HasPriorities, "Priorities require a delegate with the Priorities trait." );
+
+        return InsertPrioritised( a_Priority.Value, 0, std::forward< T >( a_Function ) );
+    }
+
+    // Add an instance and member function to the delegate with the given priority.
+    template < auto _Function, typename Object >
+    DelegateHandle Add( DelegatePriority a_Priority, Object* a_Object, MemberFunction< _Function > a_Function = MemberFunction< _Function >{} )
+    {
+        static_assert( HasPriorities, "Priorities require a delegate with the Priorities trait." );
+
+        Register< _Function >();
+        return InsertPrioritised( a_Priority.Value, 0, a_Object, a_Function );
+    }
+
+    // Add an instance owned by a std::shared_ptr and member function to the delegate, without keeping the instance alive. The
+    // invoker is skipped once the instance is destroyed, and removed by the first add or remove after the broadcast that finds it
+    // expired. Adds nothing and returns an invalid handle if there is no instance.
+    template < auto _Function, typename Object >
+    DelegateHandle Add( const std::shared_ptr< Object >& a_Object, MemberFunction< _Function > a_Function = MemberFunction< _Function >{} )
+    {
+        static_assert( _Traits::WeakTargets, "Weak invokers require a delegate with the WeakTargets trait." );
+
+        return a_Object ? Weaken( Add( a_Object.get(), a_Function ), a_Object ) : DelegateHandle{};
+    }
+
+    // Add an instance referred to by a std::weak_ptr and member function to the delegate, without keeping the instance alive.
+    template < auto _Function, typename Object >
+    DelegateHandle Add( const std::weak_ptr< Object >& a_Object, MemberFunction< _Function > a_Function = MemberFunction< _Function >{} )
+    {
+        return Add( a_Object.lock(), a_Function );
+    }
+
+    // Add a functor or function to the delegate that expires with a_Lifetime, such as a lambda capturing an object owned by a
+    // std::shared_ptr. Objects owned otherwise can hold a std::shared_ptr< void > as a liveness token and reset it when destroyed.
+    // Adds nothing and returns an invalid handle if a_Lifetime has already expired.
+    template < typename T >
+    DelegateHandle Add( const std::weak_ptr< const void >& a_Lifetime, T&& a_Function )
+    {
+        static_assert( _Traits::WeakTargets, "Weak invokers require a delegate with the WeakTargets trait." );
+
+        return !a_Lifetime.expired() ? Weaken( Add( std::forward< T >( a_Function ) ), a_Lifetime ) : DelegateHandle{};
+    }
+
+    // Add a functor or function that may be called in parallel with the delegate's other parallel safe invokers.
+    template < typename T >
+    DelegateHandle AddParallel( T&& a_Function )
+    {
+        static_assert( _Traits::ParallelBroadcast, "Parallel invokers require a delegate with the ParallelBroadcast trait." );
+
+        return InsertPrioritised( 0, DelegateHelpers::ParallelSafe, std::forward< T >( a_Function ) );
+    }
+
+    // Add an instance and member function that may be called in parallel with the delegate's other parallel safe invokers.
+    template < auto _Function, typename Object >
+    DelegateHandle AddParallel( Object* a_Object, MemberFunction< _Function > a_Function = MemberFunction< _Function >{} )
+    {
+        static_assert( _Traits::ParallelBroadcast, "Parallel invokers require a delegate with the ParallelBroadcast trait." );
+
+        Register< _Function >();
+        return InsertPrioritised( 0, DelegateHelpers::ParallelSafe, a_Object, a_Function );
+    }
+
+    // Add a functor or function to the delegate at the given index. It takes the priority of the invoker it is inserted before.
+    template < typename T >
+    DelegateHandle Add( size_t a_Index, T&& a_Function )
+    {
+        if ( !Accepts< T >() )
+        {
+            return DelegateHandle{};
+        }
+
+        MoveCursors( a_Index, 1 );
+
+        const DelegateHandle Handle = Insert( a_Index, PriorityAt( a_Index ), 0, std::forward< T >( a_Function ) );
+
+        // The index counts tombstones, so the list is only compacted once the invoker is in place.
+        CompactPending();
+        return Handle;
+    }
+
+    // Add an instance and member function to the delegate at the given index.
+    template < auto _Function, typename Object >
+    DelegateHandle Add( size_t a_Index, Object* a_Object, MemberFunction< _Function > a_Function = MemberFunction< _Function >{} )
+    {
+        if ( !Accepts< Object*, MemberFunction< _Function > >() )
+        {
+            return DelegateHandle{};
+        }
+
+        MoveCursors( a_Index, 1 );
+
+        Register< _Function >();
+        const DelegateHandle Handle = Insert( a_Index, PriorityAt( a_Index ), 0, a_Object, a_Function );
+
+        CompactPending();
+        return Handle;
+    }
+
+    // Add a functor or function to the delegate if it isn't already added to the delegate. Returns the handle of the added or
+    // already added invoker.
+    template < typename T >
+    DelegateHandle AddUnique( T&& a_Function )
+    {
+        const int32_t Found = Find( a_Function );
+
+        if ( Found >= 0 )
+        {
+            return GetHandle( Found );
+        }
+
+        return InsertPrioritised( 0, 0, std::forward< T >( a_Function ) );
+    }
+
+    // Add an instance and member function to the delegate if it isn't already added to the delegate. Returns the handle of the
+    // added or already added invoker.
+    template < auto _Function, typename Object >
+    DelegateHandle AddUnique( Object* a_Object, MemberFunction< _Function > a_Function = MemberFunction< _Function >{} )
+    {
+        const int32_t Found = Find( a_Object, a_Function );
+
+        if ( Found >= 0 )
+        {
+            return GetHandle( Found );
+        }
+
+        Register< _Function >();
+        return InsertPrioritised( 0, 0, a_Object, a_Function );
+    }
+
+    // Add a functor or function to the delegate if it isn't already added to the delegate, at the given index.
+    template < typename T >
+    DelegateHandle AddUnique( size_t a_Index, T&& a_Function )
+    {
+        const int32_t Found = Find( a_Function );
+
+        if ( Found >= 0 )
+        {
+            return GetHandle( Found );
+        }
+
+        if ( !Accepts< T >() )
+        {
+            return DelegateHandle{};
+        }
+
+        MoveCursors( a_Index, 1 );
+
+        const DelegateHandle Handle = Insert( a_Index, PriorityAt( a_Index ), 0, std::forward< T >( a_Function ) );
+
+        CompactPending();
+        return Handle;
+    }
+
+    // Add an instance and member function to the delegate if it isn't already added to the delegate, at the given index.
+    template < auto _Function, typename Object >
+    DelegateHandle AddUnique( size_t a_Index, Object* a_Object, MemberFunction< _Function > a_Function = MemberFunction< _Function >{} )
+    {
+        const int32_t Found = Find( a_Object, a_Function );
+
+        if ( Found >= 0 )
+        {
+            return GetHandle( Found );
+        }
+
+        if ( !Accepts< Object*, MemberFunction< _Function > >() )
+        {
+            return DelegateHandle{};
+        }
+
+        MoveCursors( a_Index, 1 );
+
+        Register< _Function >();
+        const DelegateHandle Handle = Insert( a_Index, PriorityAt( a_Index ), 0, a_Object, a_Function );
+
+        CompactPending();
+        return Handle;
+    }
+
+    // Add a functor or function to the delegate, and remove it when the returned subscription is destroyed. The delegate must
+    // outlive the subscription and must not be moved while it is alive.
+    template < typename T >
+    ScopedSubscription< BasicDelegate > Subscribe( T&& a_Function )
+    {
+        static_assert( HasHandles, "Subscriptions require a delegate with the Handles trait." );
+
+        return ScopedSubscription< BasicDelegate >( *this, Add( std::forward< T >( a_Function ) ) );
+    }
+
+    // Add an instance and member function to the delegate, and remove it when the returned subscription is destroyed.
+    template < auto _Function, typename Object >
+    ScopedSubscription< BasicDelegate > Subscribe( Object* a_Object, MemberFunction< _Function > a_Function = MemberFunction< _Function >{} )
+    {
+        static_assert( HasHandles, "Subscriptions require a delegate with the Handles trait." );
+
+        return ScopedSubscription< BasicDelegate >( *this, Add( a_Object, a_Function ) );
+    }
+
+    // Remove a functor or function from the delegate.
+    template < typename T >
+    void Remove( T&& a_Function )
+    {
+        const int32_t Found = Find( a_Function );
+
+        if ( Found >= 0 )
+        {
+            RemoveAt( Found );
+        }
+    }
+
+    // Remove an instance and member function from the delegate.
+    template < auto _Function, typename Object >
+    void Remove( Object* a_Object, MemberFunction< _Function > a_Function = MemberFunction< _Function >{} )
+    {
+        const int32_t Found = Find( a_Object, a_Function );
+
+        if ( Found >= 0 )
+        {
+            RemoveAt( Found );
+        }
+    }
+
+    // Remove an invoker from the delegate at the given index.
+    void Remove( size_t a_Index ) { RemoveAt( a_Index ); }
+
+    // Remove the invoker a handle refers to, without searching. Does nothing if it has already been removed.
+    void Remove( DelegateHandle a_Handle )
+    {
+        static_assert( HasHandles, "Handles require a delegate with the Handles trait." );
+
+        uint32_t Index = m_SlotMap.Find( a_Handle );
+
+        if ( Index != UINT32_MAX )
+        {
+            Remove( static_cast< size_t >( Index ) );
+        }
+    }
+
+    // Is the invoker a handle refers to still in the delegate?
+    inline bool Contains( DelegateHandle a_Handle ) const { return IndexOf( a_Handle ) >= 0; }
+
+    // Get the index of the invoker a handle refers to, or -1 if it has been removed.
+    inline int32_t IndexOf( DelegateHandle a_Handle ) const
+    {
+        static_assert( HasHandles, "Handles require a delegate with the Handles trait." );
+
+        uint32_t Index = m_SlotMap.Find( a_Handle );
+        return Index != UINT32_MAX ? static_cast< int32_t >( Index ) : -1;
+    }
+
+    // Has the target of the weak invoker at the given index been destroyed? Expired invokers are skipped, and removed after the
+    // broadcast that finds them.
+    inline bool IsExpired( size_t a_Index ) const
+    {
+        if constexpr ( _Traits::WeakTargets )
+        {
+            return ( m_Flags[ a_Index ] & DelegateHelpers::Weak ) && m_Lifetimes.Targets[ m_Slots[ a_Index ] ].expired();
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    // Get the priority of the invoker at the given index.
+    inline DelegatePriority GetPriority( size_t a_Index ) const { return DelegatePriority( PriorityAt( a_Index ) ); }
+
+    // Get the handle of the invoker at the given index, or an invalid handle if the delegate's traits keep no handles.
+    inline DelegateHandle GetHandle( size_t a_Index ) const
+    {
+        if constexpr ( HasHandles )
+        {
+            return m_Slots[ a_Index ] != UINT32_MAX ? DelegateHandle{ m_Slots[ a_Index ], m_SlotMap.Entries[ m_Slots[ a_Index ] ].Generation } : DelegateHandle{};
+        }
+        else
+        {
+            return DelegateHandle{};
+        }
+    }
+
+    // Remove all invokers from the delegate that match the given functor or function.
+    template < typename T >
+    void RemoveAll( T&& a_Function )
+    {
+        // Each removal takes its invoker out of the index, so the last invoker left is found again until none are left. Last first,
+        // the same order as searching backwards.
+        if constexpr ( IsIndexed< T > )
+        {
+            for ( int32_t Found; ( Found = Find( a_Function, true ) ) >= 0; )
+            {
+                Detach( Found );
+            }
+        }
+        else
+        {
+            // Backwards, so that invokers moved into removed places have already been checked.
+            for ( size_t i = m_Invokers.size(); i-- > 0; )
+            {
+                if ( m_Invokers[ i ] == a_Function )
+                {
+                    Detach( i );
+                }
+            }
+        }
+
+        CompactSparse();
+    }
+
+    // Remove all invokers from the delegate that match the given instance and member function.
+    template < auto _Function, typename Object >
+    void RemoveAll( Object* a_Object, MemberFunction< _Function > a_Function = MemberFunction< _Function >{} )
+    {
+        if constexpr ( _Traits::HashIndex )
+        {
+            for ( int32_t Found; ( Found = Find( a_Object, a_Function, true ) ) >= 0; )
+            {
+                Detach( Found );
+            }
+        }
+        else
+        {
+            const FunctionType Function = InvokerType::template Invocation< _Function >;
+
+            for ( size_t i = m_Invokers.size(); i-- > 0; )
+            {
+                if ( m_Invokers[ i ].m_Object == a_Object && m_Invokers[ i ].m_Function == Function )
+                {
+                    Detach( i );
+                }
+            }
+        }
+
+        CompactSparse();
+    }
+
+    // Call all contained invokers with the given arguments. _Safe set to true will call invokers safely. Broadcasts started by
+    // listeners are handled as configured by the delegate's traits, and ignored by default.
+    template < bool _Safe = false >
+    void Broadcast( InvokerHelpers::ParameterType< Args >... a_Args ) const
+    {
+        if ( m_IsBroadcasting )
+        {
+            Reenter( std::forward< InvokerHelpers::ParameterType< Args > >( a_Args )... );
+            return;
+        }
+
+        m_IsBroadcasting = true;
+
+        RunBroadcast( [&]
+        {
+            Dispatch( std::forward< InvokerHelpers::ParameterType< Args > >( a_Args )... );
+
+            // Queued broadcasts follow this one, so awaiters are resumed with its arguments first.
+            if constexpr ( _Traits::Reentrancy == DelegateReentrancy::Queue )
+            {
+                ResumeAwaiters( a_Args... );
+                DispatchPending();
+            }
+        } );
+
+        m_IsBroadcasting = false;
+        m_Index = -1;
+
+        DeferCompaction();
+
+        if constexpr ( _Traits::Reentrancy != DelegateReentrancy::Queue )
+        {
+            ResumeAwaiters( a_Args... );
+        }
+    }
+
+    // Broadcast each event in [a_Begin, a_End), a tuple of arguments, calling every invoker with all of the events before calling
+    // the next invoker, so that each listener runs back to back over the batch. Runs as one broadcast: invokers added and removed by
+    // listeners, broadcasts started by listeners, instrumentation and tracing are handled as by Broadcast, and awaiting coroutines
+    // are resumed once per event afterwards. An invoker removed by a listener receives none of the remaining events. If the
+    // delegate is already broadcasting, each event is handled as a broadcast started by a listener.
+    template < typename Iterator >
+    void BroadcastBatch( Iterator a_Begin, Iterator a_End ) const
+    {
+        static_assert( ( !std::is_rvalue_reference_v< InvokerHelpers::ParameterType< Args > > && ... ), "Batched events are passed to every invoker, so arguments cannot be passed by rvalue reference." );
+
+        if ( m_IsBroadcasting )
+        {
+            for ( Iterator Event = a_Begin; Event != a_End; ++Event )
+            {
+                std::apply( [ this ]( auto&... a_Values ) { Reenter( a_Values... ); }, *Event );
+            }
+
+            return;
+        }
+
+        const auto ResumeBatch = [&]
+        {
+            for ( Iterator Event = a_Begin; Event != a_End; ++Event )
+            {
+                std::apply( [ this ]( auto&... a_Values ) { ResumeAwaiters( a_Values... ); }, *Event );
+            }
+        };
+
+        m_IsBroadcasting = true;
+
+        RunBroadcast( [&]
+        {
+            for ( m_Index = 0; m_Index < static_cast< int32_t >( m_Invokers.size() ); ++m_Index )
+            {
+                m_IsCursorRemoved = false;
+
+                for ( Iterator Event = a_Begin; Event != a_End && IsCursorCallable(); ++Event )
+                {
+                    std::apply( [&]( auto&... a_Values ) { ( void )Call( m_Index, [&]() -> Return { return m_Invokers[ m_Index ].InvokeUntraced( a_Values... ); } ); }, *Event );
+                }
+            }
+
+            if constexpr ( _Traits::Reentrancy == DelegateReentrancy::Queue )
+            {
+                ResumeBatch();
+                DispatchPending();
+            }
+        } );
+
+        m_IsBroadcasting = false;
+        m_Index = -1;
+
+        DeferCompaction();
+
+        if constexpr ( _Traits::Reentrancy != DelegateReentrancy::Queue )
+        {
+            ResumeBatch();
+        }
+    }
+
+    // Call all contained invokers with the given arguments, and write each invoker's result to a_Output in invocation order.
+    // Returns the output iterator past the last result written. Nothing is written if the delegate is already broadcasting.
+    template < typename OutputIterator >
+    OutputIterator BroadcastCollect( OutputIterator a_Output, InvokerHelpers::ParameterType< Args >... a_Args ) const
+    {
+        static_assert( !std::is_void_v< Return >, "Only results of non-void delegates can be collected." );
+
+        ForEachResult( [&]( Return&& a_Result ) { *a_Output = std::forward< Return >( a_Result ); ++a_Output; return true; }, std::forward< InvokerHelpers::ParameterType< Args > >( a_Args )... );
+        return a_Output;
+    }
+
+#if CALLABLE_SPAN
+    // Call all contained invokers with the given arguments, and write their results to a_Results in invocation order. Invokers
+    // past the end of a_Results are still called, their results are discarded. Returns the count of results written.
+    size_t BroadcastCollect( std::span< std::conditional_t< std::is_void_v< Return >, char, std::remove_reference_t< Return > > > a_Results, InvokerHelpers::ParameterType< Args >... a_Args ) const
+    {
+        size_t Count = 0;
+        ForEachResult( [&]( Return&& a_Result ) { if ( Count < a_Results.size() ) { a_Results[ Count++ ] = std::forward< Return >( a_Result ); } return true; }, std::forward< InvokerHelpers::ParameterType< Args > >( a_Args )... );
+        return Count;
+    }
+#endif
+
+    // Call all contained invokers with the given arguments, and fold their results into a_Initial with a_Operation( Value, Result )
+    // in invocation order. Returns a_Initial if the delegate is already broadcasting.
+    template < typename T, typename Operation >
+    T BroadcastReduce( T a_Initial, Operation&& a_Operation, InvokerHelpers::ParameterType< Args >... a_Args ) const
+    {
+        static_assert( !std::is_void_v< Return >, "Only results of non-void delegates can be reduced." );
+
+        ForEachResult( [&]( Return&& a_Result ) { a_Initial = a_Operation( std::move( a_Initial ), std::forward< Return >( a_Result ) ); return true; }, std::forward< InvokerHelpers::ParameterType< Args > >( a_Args )... );
+        return a_Initial;
+    }
+
+    // Call invokers in order until one returns true. Returns whether any did. Invokers after the first true result are not called.
+    bool AnyOf( InvokerHelpers::ParameterType< Args >... a_Args ) const
+    {
+        static_assert( std::is_convertible_v< Return, bool >, "AnyOf requires invokers that return a value convertible to bool." );
+
+        bool Result = false;
+        ForEachResult( [&]( Return&& a_Result ) { Result = static_cast< bool >( a_Result ); return !Result; }, std::forward< InvokerHelpers::ParameterType< Args > >( a_Args )... );
+        return Result;
+    }
+
+    // Call invokers in order until one returns false. Returns whether all returned true. Invokers after the first false result are
+    // not called.
+    bool AllOf( InvokerHelpers::ParameterType< Args >... a_Args ) const
+    {
+        static_assert( std::is_convertible_v< Return, bool >, "AllOf requires invokers that return a value convertible to bool." );
+
+        bool Result = true;
+        ForEachResult( [&]( Return&& a_Result ) { Result = static_cast< bool >( a_Result ); return Result; }, std::forward< InvokerHelpers::ParameterType< Args > >( a_Args )... );
+        return Result;
+    }
+
+    // Call all contained invokers with the given arguments, running the parallel safe invokers on a_Pool in chunks of a_Grain.
+    // Other invokers are called first, in order, on the calling thread. There is no order between parallel safe invokers, and
+    // listeners must not modify the delegate during a parallel broadcast. a_Pool is a WorkStealingPool, or any type providing
+    // ParallelFor( Count, Grain, Function( Begin, End ) ) that returns once all chunks have finished.
+    template < typename _Pool >
+    void BroadcastParallel( _Pool& a_Pool, size_t a_Grain, InvokerHelpers::ParameterType< Args >... a_Args ) const
+    {
+        ForEachParallel( a_Pool, a_Grain, [&]( const InvokerType& a_Invoker, size_t ) { ( void )a_Invoker.InvokeUntraced( a_Args... ); }, a_Args... );
+    }
+
+    // Broadcast in parallel as BroadcastParallel, and collect the value returned by each invoker in invocation list order.
+    template < typename _Pool >
+    std::vector< Return > CollectParallel( _Pool& a_Pool, size_t a_Grain, InvokerHelpers::ParameterType< Args >... a_Args ) const
+    {
+        static_assert( !std::is_void_v< Return > && std::is_default_constructible_v< Return >, "Collected return values must be default constructible." );
+
+        std::vector< Return > Results( m_Invokers.size() );
+        ForEachParallel( a_Pool, a_Grain, [&]( const InvokerType& a_Invoker, size_t a_Index ) { Results[ a_Index ] = a_Invoker.InvokeUntraced( a_Args... ); }, a_Args... );
+        return Results;
+    }
+
+    // Call all contained invokers with the given arguments. Invokers will be called unsafely.
+    void operator()( InvokerHelpers::ParameterType< Args >... a_Args ) const
+    {
+        Broadcast( std::forward< InvokerHelpers::ParameterType< Args > >( a_Args )... );
+    }
+
+    // Clear the delegate.
+    inline void Clear()
+    {
+        if constexpr ( HasHandles )
+        {
+            for ( uint32_t Slot : m_Slots )
+            {
+                if ( Slot != UINT32_MAX )
+                {
+                    m_SlotMap.Release( Slot );
+                }
+            }
+        }
+
+        m_Invokers.clear();
+        ResizeValues( 0 );
+        m_Tombstones = 0;
+        m_IsCompactPending = false;
+        Unindex();
+        ClearLifetimes();
+        Synchronise( 0 );
+        m_Index = -1;
+    }
+
+    // Remove the tombstones of removed invokers, and weak invokers that have expired, from the invocation list, keeping the order
+    // of the others. Does nothing while broadcasting, the list is compacted by the next add or remove instead.
+    void Compact()
+    {
+        if ( m_IsBroadcasting || ( m_Tombstones == 0 && !_Traits::WeakTargets ) )
+        {
+            return;
+        }
+
+        Purge( []( size_t ) { return false; } );
+    }
+
+    // Remove every invoker bound to the given object, whatever function it is bound with. Returns how many were removed. Takes one
+    // pass over the invocation list, or only visits the object's invokers with an object index.
+    template < typename Object >
+    size_t RemoveObject( Object* a_Object )
+    {
+        const void* Target = a_Object;
+        size_t Count = 0;
+
+        if constexpr ( _Traits::ObjectIndex )
+        {
+            if ( _Traits::StableOrder || !m_IsBroadcasting )
+            {
+                for ( auto Found = m_Objects.Entries.find( Target ); Found != m_Objects.Entries.end(); Found = m_Objects.Entries.find( Target ) )
+                {
+                    Detach( m_SlotMap.Entries[ Found->second ].Index );
+                    ++Count;
+                }
+
+                CompactSparse();
+                return Count;
+            }
+        }
+
+        if constexpr ( _Traits::StableOrder )
+        {
+            // The list is not compacted during a broadcast of a delegate that keeps its order, the invokers are left as tombstones.
+            if ( m_IsBroadcasting )
+            {
+                for ( size_t i = 0; i < m_Invokers.size(); ++i )
+                {
+                    if ( m_Invokers[ i ].m_Object == Target && !( m_Flags[ i ] & DelegateHelpers::Tombstone ) )
+                    {
+                        Erase( i );
+                        ++Count;
+                    }
+                }
+
+                return Count;
+            }
+        }
+        else if ( !m_IsBroadcasting )
+        {
+            // Searching backwards, the invokers swapped into the place of removed ones have already been visited.
+            for ( size_t i = m_Invokers.size(); i-- > 0; )
+            {
+                if ( m_Invokers[ i ].m_Object == Target )
+                {
+                    Erase( i );
+                    ++Count;
+                }
+            }
+
+            CompactPending();
+            return Count;
+        }
+
+        // Swapping in the last invoker during a broadcast could skip it, so the list is purged in one pass keeping its order.
+        return Purge( [&]( size_t a_Index ) { return m_Invokers[ a_Index ].m_Object == Target; } );
+    }
+
+    // Is the delegate currently broadcasting.
+    inline bool IsBroadcasting() const { return m_IsBroadcasting; }
+
+    // Get how many broadcasts started by listeners were dropped, recursed into and queued.
+    inline const DelegateReentrancyCounters& GetReentrancyCounters() const { return m_Reentrancy; }
+
+    // Reset the counts of broadcasts started by listeners.
+    inline void ResetReentrancyCounters() { m_Reentrancy = DelegateReentrancyCounters(); }
+
+    // Take a snapshot of the statistics of an instrumented delegate, with an entry per invoker in invocation list order. Counters
+    // are read without blocking, so the snapshot may be taken from another thread during a broadcast whose listeners do not add or
+    // remove invokers.
+    DelegateStatistics GetStatistics() const
+    {
+        static_assert( _Traits::Instrumented, "Statistics are only recorded by delegates with Instrumented traits." );
+
+        DelegateStatistics Statistics;
+        m_Statistics.Broadcasts.Load( Statistics.Broadcasts );
+        m_Statistics.Calls.Load( Statistics.Calls );
+        Statistics.Listeners.reserve( Size() );
+
+        for ( size_t i = 0; i < m_Invokers.size(); ++i )
+        {
+            // Tombstones have no slot.
+            if ( m_Slots[ i ] == UINT32_MAX )
+            {
+                continue;
+            }
+
+            DelegateListenerStatistics& Listener = Statistics.Listeners.emplace_back();
+            m_Statistics.Listeners[ m_Slots[ i ] ].Load( Listener );
+            Listener.Handle = GetHandle( i );
+            Listener.Index = i;
+        }
+
+        return Statistics;
+    }
+
+    // Reset the statistics of an instrumented delegate to zero.
+    void ResetStatistics()
+    {
+        if constexpr ( _Traits::Instrumented )
+        {
+            m_Statistics.Broadcasts.Reset();
+            m_Statistics.Calls.Reset();
+
+            for ( size_t i = 0; i < m_SlotMap.Entries.size(); ++i )
+            {
+                m_Statistics.Track( static_cast< uint32_t >( i ) );
+            }
+        }
+    }
+
+    // Name the delegate in trace events. The name is not copied, so it must outlive the delegate and any trace flushed after it,
+    // as a string literal does. Copies of the delegate share its name, while assigning to it keeps its own.
+    inline void SetName( const char* a_Name ) { m_Name = a_Name; }
+
+    // Get the name of the delegate in trace events, or null if it has none.
+    inline const char* GetName() const { return m_Name; }
+
+    // The count of stored invokers. Tombstones of removed invokers in the invocation list are not counted, expired invokers are
+    // until they are removed.
+    inline size_t Size() const { return m_Invokers.size() - m_Tombstones; }
+
+    // Is this delegate empty?
+    inline bool Empty() const { return Size() == 0; }
+
+    // Make room for a_Capacity invokers, so that adding invokers with inline callables up to that count allocates nothing.
+    void Reserve( size_t a_Capacity )
+    {
+        m_Invokers.reserve( a_Capacity );
+
+        if constexpr ( HasFlags )
+        {
+            m_Flags.reserve( a_Capacity );
+        }
+
+        if constexpr ( HasPriorities )
+        {
+            m_Priorities.reserve( a_Capacity );
+        }
+
+        if constexpr ( HasHandles )
+        {
+            m_Slots.reserve( a_Capacity );
+            m_SlotMap.Entries.reserve( a_Capacity );
+        }
+    }
+
+    // Get the allocator used for the invocation list.
+    inline AllocatorType GetAllocator() const { return m_Invokers.get_allocator(); }
+
+    // Get the collection of all invokers. For delegates that keep their order, it may contain unbound tombstones of removed
+    // invokers until it is compacted.
+    inline const ContainerType& GetInvocationList() const { return m_Invokers; }
+
+    // Get begin iterator.
+    inline IteratorType Begin() { Invalidate(); return m_Invokers.begin(); }
+
+    // Get begin iterator.
+    inline CIteratorType Begin() const { return m_Invokers.begin(); }
+
+    // Get begin iterator.
+    inline CIteratorType CBegin() const { return m_Invokers.cbegin(); }
+
+    // Get reverse begin iterator.
+    inline RIteratorType RBegin() { Invalidate(); return m_Invokers.rbegin(); }
+
+    // Get reverse begin iterator.
+    inline CRIteratorType RBegin() const { return m_Invokers.rbegin(); }
+
+    // Get reverse begin iterator.
+    inline CRIteratorType CRBegin() const { return m_Invokers.crbegin(); }
+
+    // Get end iterator.
+    inline IteratorType End() { Invalidate(); return m_Invokers.end(); }
+
+    // Get end iterator.
+    inline CIteratorType End() const { return m_Invokers.end(); }
+
+    // Get end iterator.
+    inline CIteratorType CEnd() const { return m_Invokers.cend(); }
+
+    // Get reverse end iterator.
+    inline RIteratorType REnd() { Invalidate(); return m_Invokers.rend(); }
+
+    // Get reverse end iterator.
+    inline CRIteratorType REnd() const { return m_Invokers.rend(); }
+
+    // Get reverse end iterator.
+    inline CRIteratorType CREnd() const { return m_Invokers.crend(); }
+
+    // Copy from another delegate.
+    BasicDelegate& operator=( const BasicDelegate& a_Delegate )
+    {
+        m_Invokers = a_Delegate.m_Invokers;
+        m_Flags = a_Delegate.m_Flags;
+        m_Priorities = a_Delegate.m_Priorities;
+        m_Slots = a_Delegate.m_Slots;
+        m_SlotMap = a_Delegate.m_SlotMap;
+        m_Lifetimes = a_Delegate.m_Lifetimes;
+        m_Tombstones = a_Delegate.m_Tombstones;
+        m_IsCompactPending = a_Delegate.m_IsCompactPending;
+        m_Consumer = a_Delegate.m_Consumer;
+        CopyRegistry( a_Delegate );
+        IndexAll();
+        ResetStatistics();
+        Synchronise( 0 );
+        m_IsBroadcasting = false;
+        m_Index = -1;
+        return *this;
+    }
+
+    // Move from another delegate.
+    BasicDelegate& operator=( BasicDelegate&& a_Delegate )
+    {
+        m_Invokers = std::move( a_Delegate.m_Invokers );
+        m_Flags = std::move( a_Delegate.m_Flags );
+        m_Priorities = std::move( a_Delegate.m_Priorities );
+        m_Slots = std::move( a_Delegate.m_Slots );
+        m_SlotMap = std::move( a_Delegate.m_SlotMap );
+        m_Lifetimes = std::move( a_Delegate.m_Lifetimes );
+        m_Tombstones = a_Delegate.m_Tombstones;
+        m_IsCompactPending = a_Delegate.m_IsCompactPending;
+        m_Consumer = a_Delegate.m_Consumer;
+        a_Delegate.ResizeValues( a_Delegate.m_Invokers.size() );
+        a_Delegate.ResetSlots();
+        a_Delegate.m_Tombstones = 0;
+        a_Delegate.m_IsCompactPending = false;
+        CopyRegistry( a_Delegate );
+        IndexAll();
+        ResetStatistics();
+        Synchronise( 0 );
+        a_Delegate.Synchronise( 0 );
+        m_IsBroadcasting = false;
+        m_Index = -1;
+        a_Delegate.m_Index = -1;
+        return *this;
+    }
+
+    // Add a functor or function object to the delegate.
+    template < typename T >
+    inline BasicDelegate& operator+=( T&& a_Function ) { Add( std::forward< T >( a_Function ) ); return *this; }
+
+    // Remove a functor or function object to the delegate.
+    template < typename T >
+    inline BasicDelegate& operator-=( T&& a_Function ) { Remove( std::forward< T >( a_Function ) ); return *this; }
+
+    // Get the stored invoker at a given index.
+    template < typename T >
+    inline InvokerType& operator[]( size_t a_Index ) { Invalidate(); return m_Invokers[ a_Index ]; }
+
+    // Get the stored invoker at a given index.
+    template < typename T >
+    inline const InvokerType& operator[]( size_t a_Index ) const { return m_Invokers[ a_Index ]; }
+
+private:
+
+    // Call every invoker from the start of the invocation list.
+    void Dispatch( InvokerHelpers::ParameterType< Args >... a_Args ) const
+    {
+        m_Index = 0;
+
+        // Listeners may add and remove invokers, which moves the cursor and the arrays, so both are read again after each call.
+        if constexpr ( _Traits::StructureOfArrays )
+        {
+            if ( m_Table.IsDirty )
+            {
+                Synchronise( 0 );
+            }
+
+            // Runs are only valid until a listener modifies the delegate, after that the rest of the broadcast is not batched.
+            const uint32_t Version = BuildRuns();
+
+            for ( ; m_Index < static_cast< int32_t >( m_Table.Functions.size() ); ++m_Index )
+            {
+                if ( SkipExpired( m_Index ) )
+                {
+                    continue;
+                }
+
+                if constexpr ( IsBatched )
+                {
+                    if ( m_Table.Version == Version && m_Table.Runs[ m_Index ] > 1 )
+                    {
+                        m_Table.Batches[ m_Index ]( m_Table.Objects.data(), m_Index, m_Index + m_Table.Runs[ m_Index ], m_Table.Version, std::forward< InvokerHelpers::ParameterType< Args > >( a_Args )... );
+                        continue;
+                    }
+                }
+
+                ( void )Call( m_Index, [&]() -> Return { return m_Table.Functions[ m_Index ]( m_Table.Objects[ m_Index ], std::forward< InvokerHelpers::ParameterType< Args > >( a_Args )... ); } );
+            }
+        }
+        else
+        {
+            for ( ; m_Index < static_cast< int32_t >( m_Invokers.size() ); ++m_Index )
+            {
+                if ( SkipExpired( m_Index ) )
+                {
+                    continue;
+                }
+
+                ( void )Call( m_Index, [&]() -> Return { return m_Invokers[ m_Index ].InvokeUntraced( std::forward< InvokerHelpers::ParameterType< Args > >( a_Args )... ); } );
+            }
+        }
+    }
+
+    // Call the invoker at the given index through a_Call, tracing the call while tracing is enabled.
+    template < typename Function >
+    decltype( auto ) Call( size_t a_Index, Function&& a_Call ) const
+    {
+#if CALLABLE_TRACING
+        if ( Tracer::IsEnabled() )
+        {
+            const Tracer::Scope Scope( TraceHelpers::EventKind::Listener, m_Name, a_Index, m_Invokers[ a_Index ].GetTraceSymbol() );
+            return TimeCall( a_Index, a_Call );
+        }
+#endif
+
+        return TimeCall( a_Index, a_Call );
+    }
+
+    // Call the invoker at the given index through a_Call, recording the call if the delegate is instrumented. Calls to tombstones,
+    // which have no slot, are not recorded.
+    template < typename Function >
+    decltype( auto ) TimeCall( size_t a_Index, Function& a_Call ) const
+    {
+        if constexpr ( _Traits::Instrumented )
+        {
+            if ( m_Slots[ a_Index ] != UINT32_MAX )
+            {
+                typename InstrumentationType::template Timer< decltype( m_Statistics.Calls ) > Timer( m_Statistics.Calls, &m_Statistics.Listeners[ m_Slots[ a_Index ] ] );
+                return a_Call();
+            }
+        }
+
+        return a_Call();
+    }
+
+    // Run a whole broadcast through a_Broadcast, tracing it while tracing is enabled.
+    template < typename Function >
+    void RunBroadcast( Function&& a_Broadcast ) const
+    {
+#if CALLABLE_TRACING
+        if ( Tracer::IsEnabled() )
+        {
+            const Tracer::Scope Scope( TraceHelpers::EventKind::Broadcast, m_Name, 0, nullptr );
+            TimeBroadcast( a_Broadcast );
+            return;
+        }
+#endif
+
+        TimeBroadcast( a_Broadcast );
+    }
+
+    // Run a whole broadcast through a_Broadcast, recording it if the delegate is instrumented.
+    template < typename Function >
+    void TimeBroadcast( Function& a_Broadcast ) const
+    {
+        if constexpr ( _Traits::Instrumented )
+        {
+            typename InstrumentationType::template Timer< decltype( m_Statistics.Broadcasts ) > Timer( m_Statistics.Broadcasts );
+            a_Broadcast();
+        }
+        else
+        {
+            a_Broadcast();
+        }
+    }
+
+    // Is the invoker at the cursor still the one the cursor was last moved to, and neither a tombstone nor expired?
+    bool IsCursorCallable() const
+    {
+        if ( m_IsCursorRemoved || m_Index < 0 || m_Index >= static_cast< int32_t >( m_Invokers.size() ) )
+        {
+            return false;
+        }
+
+        if constexpr ( _Traits::StableOrder )
+        {
+            if ( m_Flags[ m_Index ] & DelegateHelpers::Tombstone )
+            {
+                return false;
+            }
+        }
+
+        return !SkipExpired( m_Index );
+    }
+
+    // Handle a broadcast started by a listener, as configured by the traits.
+    void Reenter( InvokerHelpers::ParameterType< Args >... a_Args ) const
+    {
+        if constexpr ( _Traits::Reentrancy == DelegateReentrancy::Recurse )
+        {
+            ++m_Reentrancy.Recursed;
+
+            DelegateHelpers::CursorFrame Frame{ m_Index, m_IsCursorRemoved, m_Outer };
+            m_Outer = &Frame;
+            Dispatch( std::forward< InvokerHelpers::ParameterType< Args > >( a_Args )... );
+            m_Outer = Frame.Outer;
+            m_Index = Frame.Index;
+            m_IsCursorRemoved = Frame.IsRemoved;
+
+            ResumeAwaiters( a_Args... );
+        }
+        else if constexpr ( _Traits::Reentrancy == DelegateReentrancy::Queue )
+        {
+            ++m_Reentrancy.Queued;
+            m_Pending.Events.emplace_back( std::forward< InvokerHelpers::ParameterType< Args > >( a_Args )... );
+        }
+        else
+        {
+            ++m_Reentrancy.Dropped;
+        }
+    }
+
+    // Broadcast queued arguments in the order they were queued, including those queued while doing so.
+    void DispatchPending() const
+    {
+        for ( size_t i = 0; i < m_Pending.Events.size(); ++i )
+        {
+            auto Event = std::move( m_Pending.Events[ i ] );
+            std::apply( [ this ]( auto&... a_Values )
+            {
+                Dispatch( std::forward< InvokerHelpers::ParameterType< Args > >( a_Values )... );
+                ResumeAwaiters( a_Values... );
+            }, Event );
+        }
+
+        m_Pending.Events.clear();
+    }
+
+    // Keep every broadcast cursor on the invoker it last called when an invoker is inserted at, or removed from, the given index,
+    // and record whether that invoker was the one removed.
+    void MoveCursors( size_t a_Index, int32_t a_Offset )
+    {
+        if ( !m_IsBroadcasting )
+        {
+            return;
+        }
+
+        if ( static_cast< int32_t >( a_Index ) <= m_Index )
+        {
+            m_IsCursorRemoved |= a_Offset < 0 && static_cast< int32_t >( a_Index ) == m_Index;
+            m_Index += a_Offset;
+        }
+
+        for ( DelegateHelpers::CursorFrame* Frame = m_Outer; Frame; Frame = Frame->Outer )
+        {
+            if ( static_cast< int32_t >( a_Index ) <= Frame->Index )
+            {
+                Frame->IsRemoved |= a_Offset < 0 && static_cast< int32_t >( a_Index ) == Frame->Index;
+                Frame->Index += a_Offset;
+            }
+        }
+    }
+
+    // Call invokers in order with the same handling of reentrancy and of invokers added and removed by listeners as Broadcast,
+    // passing each result to a_Consume. Stops early when a_Consume returns false.
+    template < typename Function >
+    void ForEachResult( Function&& a_Consume, InvokerHelpers::ParameterType< Args >... a_Args ) const
+    {
+        if ( m_IsBroadcasting )
+        {
+            return;
+        }
+
+        m_IsBroadcasting = true;
+
+        RunBroadcast( [&]
+        {
+            for ( m_Index = 0; m_Index < static_cast< int32_t >( m_Invokers.size() ); ++m_Index )
+            {
+                if constexpr ( _Traits::StableOrder )
+                {
+                    if ( m_Flags[ m_Index ] & DelegateHelpers::Tombstone )
+                    {
+                        continue;
+                    }
+                }
+
+                if ( SkipExpired( m_Index ) )
+                {
+                    continue;
+                }
+
+                if ( !a_Consume( Call( m_Index, [&]() -> Return { return m_Invokers[ m_Index ].InvokeUntraced( std::forward< InvokerHelpers::ParameterType< Args > >( a_Args )... ); } ) ) )
+                {
+                    break;
+                }
+            }
+        } );
+
+        m_IsBroadcasting = false;
+        m_Index = -1;
+
+        DeferCompaction();
+        ResumeAwaiters( a_Args... );
+    }
+
+    // Resume coroutines waiting for the next broadcast with its arguments.
+    template < typename... T >
+    void ResumeAwaiters( T&... a_Args ) const
+    {
+#if CALLABLE_COROUTINES
+        if constexpr ( ( std::is_copy_constructible_v< std::decay_t< Args > > && ... ) )
+        {
+            if ( m_Awaiters.Head )
+            {
+                Resume( a_Args... );
+            }
+        }
+#else
+        ( ( void )a_Args, ... );
+#endif
+    }
+
+#if CALLABLE_COROUTINES
+    // Intrusive doubly linked list of suspended awaiters.
+    struct AwaiterListType
+    {
+        NextAwaiter* Head = nullptr;
+        NextAwaiter* Tail = nullptr;
+
+        void Append( NextAwaiter& a_Awaiter )
+        {
+            a_Awaiter.m_List = this;
+            a_Awaiter.m_Previous = Tail;
+            a_Awaiter.m_Next = nullptr;
+            ( Tail ? Tail->m_Next : Head ) = &a_Awaiter;
+            Tail = &a_Awaiter;
+        }
+
+        void Remove( NextAwaiter& a_Awaiter )
+        {
+            ( a_Awaiter.m_Previous ? a_Awaiter.m_Previous->m_Next : Head ) = a_Awaiter.m_Next;
+            ( a_Awaiter.m_Next ? a_Awaiter.m_Next->m_Previous : Tail ) = a_Awaiter.m_Previous;
+            a_Awaiter.m_List = nullptr;
+        }
+    };
+
+    // Resume every coroutine waiting on the delegate. Coroutines that wait again while being resumed wait for the next broadcast.
+    // Waiting coroutines destroyed by a resumed coroutine unlink themselves from the local list.
+    template < typename... T >
+    void Resume( T&... a_Args ) const
+    {
+        AwaiterListType Resuming;
+        std::swap( Resuming.Head, m_Awaiters.Head );
+        std::swap( Resuming.Tail, m_Awaiters.Tail );
+
+        for ( NextAwaiter* Awaiter = Resuming.Head; Awaiter; Awaiter = Awaiter->m_Next )
+        {
+            Awaiter->m_List = &Resuming;
+        }
+
+        while ( NextAwaiter* Awaiter = Resuming.Head )
+        {
+            Resuming.Remove( *Awaiter );
+            Awaiter->m_Event.emplace( a_Args... );
+            Awaiter->m_Handle.resume();
+        }
+    }
+#endif
+
+    // Can a listener constructed from T... be added? Move-only arguments are passed to every listener by the same rvalue reference,
+    // so a listener that takes one by value or by rvalue reference must be the only listener.
+    template < typename... T >
+    bool Accepts() const
+    {
+        if constexpr ( !HasMoveOnlyArguments )
+        {
+            return true;
+        }
+        else if constexpr ( !DelegateHelpers::SharesArguments< ArgumentTypes, std::decay_t< T >... >::value )
+        {
+            return Size() == 0;
+        }
+        else
+        {
+            return !m_Consumer.Function || std::none_of( m_Invokers.begin(), m_Invokers.end(), [&]( const InvokerType& a_Invoker ) { return a_Invoker.m_Function == m_Consumer.Function; } );
+        }
+    }
+
+    // Construct an invoker with the given priority and flags after the invokers of the same or higher priority, and return its
+    // handle.
+    template < typename... T >
+    DelegateHandle InsertPrioritised( int32_t a_Priority, uint8_t a_Flags, T&&... a_Args )
+    {
+        if ( !Accepts< T... >() )
+        {
+            return DelegateHandle{};
+        }
+
+        CompactPending();
+
+        if constexpr ( !HasPriorities )
+        {
+            return Insert( m_Invokers.size(), a_Priority, a_Flags, std::forward< T >( a_Args )... );
+        }
+        else
+        {
+            return InsertOrdered( a_Priority, a_Flags, std::forward< T >( a_Args )... );
+        }
+    }
+
+    // Construct an invoker with the given priority and flags after the invokers of the same or higher priority in a delegate with
+    // priorities, and return its handle.
+    template < typename... T >
+    DelegateHandle InsertOrdered( int32_t a_Priority, uint8_t a_Flags, T&&... a_Args )
+    {
+        if ( m_Priorities.empty() || m_Priorities.back() >= a_Priority )
+        {
+            return Insert( m_Invokers.size(), a_Priority, a_Flags, std::forward< T >( a_Args )... );
+        }
+
+        const size_t Position = std::partition_point( m_Priorities.begin(), m_Priorities.end(), [&]( int32_t a_Other ) { return a_Other >= a_Priority; } ) - m_Priorities.begin();
+
+        // Invokers of equal priority keep their order when the delegate keeps its order, and invokers that have already been called
+        // must not move during a broadcast, so both shift every invoker after the new one. The invokers themselves stay put, only
+        // their pointers, flags, priorities and slots move.
+        if ( _Traits::StableOrder || m_IsBroadcasting )
+        {
+            MoveCursors( Position, 1 );
+            return Insert( Position, a_Priority, a_Flags, std::forward< T >( a_Args )... );
+        }
+
+        // Otherwise append the new invoker, and swap it with the first invoker of each lower priority in turn, the lowest first.
+        DelegateHandle Handle = Insert( m_Invokers.size(), a_Priority, a_Flags, std::forward< T >( a_Args )... );
+
+        for ( size_t Hole = m_Invokers.size() - 1; Hole > Position; )
+        {
+            const int32_t Lower = m_Priorities[ Hole - 1 ];
+            const size_t First = std::partition_point( m_Priorities.begin() + Position, m_Priorities.begin() + Hole, [&]( int32_t a_Other ) { return a_Other > Lower; } ) - m_Priorities.begin();
+            Swap( First, Hole );
+            Hole = First;
+        }
+
+        return Handle;
+    }
+
+    // Get the priority an invoker inserted at the given index takes, so that the invocation list stays in priority order.
+    int32_t PriorityAt( size_t a_Index ) const
+    {
+        if constexpr ( HasPriorities )
+        {
+            return a_Index < m_Priorities.size() ? m_Priorities[ a_Index ] : a_Index ? m_Priorities[ a_Index - 1 ] : 0;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+
+    // Construct an invoker with the given flags at the given index of the invocation list, and return its handle.
+    template < typename... T >
+    DelegateHandle Insert( size_t a_Index, int32_t a_Priority, uint8_t a_Flags, T&&... a_Args )
+    {
+        m_Invokers.emplace( m_Invokers.begin() + a_Index, std::forward< T >( a_Args )... );
+
+        if constexpr ( HasMoveOnlyArguments && !DelegateHelpers::SharesArguments< ArgumentTypes, std::decay_t< T >... >::value )
+        {
+            m_Consumer.Function = m_Invokers[ a_Index ].m_Function;
+        }
+
+        if constexpr ( HasFlags )
+        {
+            m_Flags.insert( m_Flags.begin() + a_Index, a_Flags );
+        }
+
+        if constexpr ( HasPriorities )
+        {
+            m_Priorities.insert( m_Priorities.begin() + a_Index, a_Priority );
+        }
+
+        if constexpr ( HasHandles )
+        {
+            m_Slots.insert( m_Slots.begin() + a_Index, m_SlotMap.Acquire( a_Index ) );
+            Index( a_Index );
+
+            if constexpr ( _Traits::Instrumented )
+            {
+                m_Statistics.Track( m_Slots[ a_Index ] );
+            }
+
+            // Invokers after the new one moved up an index.
+            Reindex( a_Index + 1 );
+        }
+        Synchronise( a_Index );
+        return GetHandle( a_Index );
+    }
+
+    // Can invokers matching a_Function be found through the hash index?
+    template < typename T >
+    static constexpr bool IsIndexed = _Traits::HashIndex && ( std::is_invoker_v< std::decay_t< T > > || std::is_convertible_v< std::decay_t< T >, StaticFunctionType > );
+
+    // Get the index of the first, or with a_Last the last, invoker matching a_Function, or -1 if there is none. Only indexed
+    // lookups find the last invoker.
+    template < typename T >
+    int32_t Find( const T& a_Function, bool a_Last = false ) const
+    {
+        if constexpr ( IsIndexed< T > )
+        {
+            if constexpr ( std::is_invoker_v< std::decay_t< T > > )
+            {
+                return Lookup( a_Function.m_Object, a_Function.m_Function, a_Last );
+            }
+            else if constexpr ( std::is_convertible_v< std::decay_t< T >, StaticFunctionType > )
+            {
+                return Lookup( reinterpret_cast< void* >( static_cast< StaticFunctionType >( a_Function ) ), InvokerType::StaticInvocation, a_Last );
+            }
+        }
+
+        for ( size_t i = 0; i < m_Invokers.size(); ++i )
+        {
+            if ( m_Invokers[ i ] == a_Function && !IsExpired( i ) )
+            {
+                return static_cast< int32_t >( i );
+            }
+        }
+
+        return -1;
+    }
+
+    // Get the index of the first invoker bound to the given instance and member function, or -1 if there is none. Compares the
+    // bound object and function directly instead of constructing an invoker to compare with.
+    template < auto _Function, typename Object >
+    int32_t Find( Object* a_Object, MemberFunction< _Function >, bool a_Last = false ) const
+    {
+        const FunctionType Function = InvokerType::template Invocation< _Function >;
+
+        if constexpr ( _Traits::HashIndex )
+        {
+            return Lookup( a_Object, Function, a_Last );
+        }
+        else
+        {
+            for ( size_t i = 0; i < m_Invokers.size(); ++i )
+            {
+                if ( m_Invokers[ i ].m_Object == a_Object && m_Invokers[ i ].m_Function == Function && !IsExpired( i ) )
+                {
+                    return static_cast< int32_t >( i );
+                }
+            }
+
+            return -1;
+        }
+    }
+
+    // Get the index of the first, or with a_Last the last, indexed invoker bound to the given object and function, or -1 if there
+    // is none.
+    int32_t Lookup( const void* a_Object, FunctionType a_Function, bool a_Last ) const
+    {
+        int32_t Found = -1;
+
+        if constexpr ( _Traits::HashIndex )
+        {
+            auto Range = m_Lookup.Entries.equal_range( InvokerHelpers::HashBinding( a_Object, a_Function ) );
+
+            for ( auto Entry = Range.first; Entry != Range.second; ++Entry )
+            {
+                const int32_t Index = static_cast< int32_t >( m_SlotMap.Entries[ Entry->second ].Index );
+                const InvokerType& Invoker = m_Invokers[ Index ];
+
+                if ( Invoker.m_Object == a_Object && Invoker.m_Function == a_Function && !IsExpired( Index ) && ( Found < 0 || ( a_Last ? Index > Found : Index < Found ) ) )
+                {
+                    Found = Index;
+                }
+            }
+        }
+
+        return Found;
+    }
+
+    // Add the invoker at the given index to the hash and object indices.
+    void Index( size_t a_Index )
+    {
+        if constexpr ( _Traits::HashIndex || _Traits::ObjectIndex )
+        {
+            const InvokerType& Invoker = m_Invokers[ a_Index ];
+
+            if ( !Invoker.IsBound() )
+            {
+                return;
+            }
+
+            if constexpr ( _Traits::HashIndex )
+            {
+                m_Lookup.Entries.emplace( std::hash< InvokerType >()( Invoker ), m_Slots[ a_Index ] );
+            }
+
+            if constexpr ( _Traits::ObjectIndex )
+            {
+                m_Objects.Entries.emplace( Invoker.m_Object, m_Slots[ a_Index ] );
+            }
+        }
+    }
+
+    // Remove the invoker at the given index from the hash and object indices.
+    void Unindex( size_t a_Index )
+    {
+        if constexpr ( _Traits::HashIndex || _Traits::ObjectIndex )
+        {
+            const InvokerType& Invoker = m_Invokers[ a_Index ];
+
+            if ( !Invoker.IsBound() )
+            {
+                return;
+            }
+
+            if constexpr ( _Traits::HashIndex )
+            {
+                m_Lookup.Erase( std::hash< InvokerType >()( Invoker ), m_Slots[ a_Index ] );
+            }
+
+            if constexpr ( _Traits::ObjectIndex )
+            {
+                m_Objects.Erase( Invoker.m_Object, m_Slots[ a_Index ] );
+            }
+        }
+    }
+
+    // Remove every invoker from the hash and object indices.
+    void Unindex()
+    {
+        if constexpr ( _Traits::HashIndex )
+        {
+            m_Lookup.Entries.clear();
+        }
+
+        if constexpr ( _Traits::ObjectIndex )
+        {
+            m_Objects.Entries.clear();
+        }
+    }
+
+    // Rebuild the hash and object indices, after the invokers were copied or moved from another delegate. Copied invokers may hold
+    // their callables at other addresses than the originals.
+    void IndexAll()
+    {
+        if constexpr ( _Traits::HashIndex || _Traits::ObjectIndex )
+        {
+            Unindex();
+
+            for ( size_t i = 0; i < m_Invokers.size(); ++i )
+            {
+                if ( m_Slots[ i ] != UINT32_MAX )
+                {
+                    Index( i );
+                }
+            }
+        }
+    }
+
+    // Release the slot of the invoker at the given index, taking it out of the indices and dropping its lifetime.
+    void ReleaseSlot( size_t a_Index )
+    {
+        Unindex( a_Index );
+
+        if constexpr ( _Traits::WeakTargets )
+        {
+            if ( m_Flags[ a_Index ] & DelegateHelpers::Weak )
+            {
+                m_Lifetimes.Targets[ m_Slots[ a_Index ] ].reset();
+            }
+        }
+
+        if constexpr ( HasHandles )
+        {
+            m_SlotMap.Release( m_Slots[ a_Index ] );
+        }
+    }
 
-public:
+    // Make the invoker a handle refers to expire with a_Lifetime.
+    DelegateHandle Weaken( DelegateHandle a_Handle, std::weak_ptr< const void > a_Lifetime )
+    {
+        if constexpr ( _Traits::WeakTargets )
+        {
+            if ( a_Handle.Slot >= m_Lifetimes.Targets.size() )
+            {
+                m_Lifetimes.Targets.resize( m_SlotMap.Entries.size() );
+            }
 
-    // Create an empty delegate.
-    Delegate()
-        : m_IsBroadcasting( false )
-        , m_Index( -1 )
-    {}
+            const size_t Index = IndexOf( a_Handle );
+            m_Lifetimes.Targets[ a_Handle.Slot ] = std::move( a_Lifetime );
+            m_Flags[ Index ] |= DelegateHelpers::Weak;
 
-    // Copies from a provided delegate.
-    Delegate( const Delegate& a_Delegate )
-        : m_Invokers( a_Delegate.m_Invokers )
-        , m_IsBroadcasting( false )
-        , m_Index( -1 )
-    {}
+            // Batch runs are rebuilt without the weak invoker.
+            Synchronise( Index, Index + 1 );
+        }
 
-    // Moves from a provided delegate.
-    Delegate( Delegate&& a_Delegate )
-        : m_Invokers( std::move( a_Delegate.m_Invokers ) )
-        , m_IsBroadcasting( false )
-        , m_Index( -1 )
+        return a_Handle;
+    }
+
+    // Is the invoker at the given index weak?
+    bool IsWeak( size_t a_Index ) const
     {
-        a_Delegate.m_Index = -1;
+        if constexpr ( _Traits::WeakTargets )
+        {
+            return m_Flags[ a_Index ] & DelegateHelpers::Weak;
+        }
+        else
+        {
+            return false;
+        }
     }
 
-    // Add a functor or function to the delegate.
-    template < typename T >
-    void Add( T&& a_Function ) { m_Invokers.emplace_back( std::forward< T >( a_Function ) ); }
+    // Is the invoker at the given index expired? Records that the delegate has expired invokers to remove if it is.
+    bool SkipExpired( size_t a_Index ) const
+    {
+        if constexpr ( _Traits::WeakTargets )
+        {
+            if ( IsExpired( a_Index ) )
+            {
+                m_Lifetimes.HasExpired = true;
+                return true;
+            }
+        }
 
-    // Add an instance and member function to the delegate.
-    template < auto _Function, typename Object >
-    void Add( Object* a_Object, MemberFunction< _Function > a_Function = MemberFunction< _Function >{} ) { m_Invokers.emplace_back( a_Object, a_Function ); }
+        return false;
+    }
 
-    // Add a functor or function to the delegate at the given index.
-    template < typename T >
-    void Add( size_t a_Index, T&& a_Function )
+    // Have broadcasts skipped expired invokers since the delegate was last compacted?
+    bool HasExpired() const
     {
-        if ( m_IsBroadcasting && a_Index <= m_Index )
+        if constexpr ( _Traits::WeakTargets )
+        {
+            return m_Lifetimes.HasExpired;
+        }
+        else
         {
-            ++m_Index;
+            return false;
         }
+    }
 
-        m_Invokers.emplace( m_Invokers.begin() + a_Index, std::forward< T >( a_Function ) );
+    // Drop the lifetimes of all weak invokers, after their slots were released.
+    void ClearLifetimes()
+    {
+        if constexpr ( _Traits::WeakTargets )
+        {
+            m_Lifetimes.Targets.clear();
+            m_Lifetimes.HasExpired = false;
+        }
     }
 
-    // Add an instance and member function to the delegate at the given index.
-    template < auto _Function, typename Object >
-    void Add( size_t a_Index, Object* a_Object, MemberFunction< _Function > a_Function = MemberFunction< _Function >{} )
+    // Remove tombstones, expired invokers and the invokers a_Remove( Index ) selects in one pass, keeping the order of the others
+    // and the broadcast cursors on the last invoker called. Returns how many invokers a_Remove selected.
+    template < typename Predicate >
+    size_t Purge( Predicate&& a_Remove )
     {
-        if ( m_IsBroadcasting && a_Index <= m_Index )
+        size_t Count = 0;
+        size_t Removed = 0;
+        size_t First = m_Invokers.size();
+
+        for ( size_t i = 0; i < m_Invokers.size(); ++i )
+        {
+            if ( IsTombstone( i ) )
+            {
+                First = std::min( First, i );
+                continue;
+            }
+
+            const bool IsSelected = a_Remove( i );
+
+            if ( IsSelected || IsExpired( i ) )
+            {
+                ReleaseSlot( i );
+                MoveCursors( Count, -1 );
+                Removed += IsSelected;
+                First = std::min( First, i );
+                continue;
+            }
+
+            if ( Count != i )
+            {
+                m_Invokers.Swap( Count, i );
+                MoveValues( i, Count );
+            }
+
+            ++Count;
+        }
+
+        m_Invokers.erase( m_Invokers.begin() + Count, m_Invokers.end() );
+        ResizeValues( Count );
+        m_Tombstones = 0;
+        m_IsCompactPending = false;
+
+        if constexpr ( _Traits::WeakTargets )
         {
-            ++m_Index;
+            m_Lifetimes.HasExpired = false;
         }
 
-        m_Invokers.emplace_back( a_Object, a_Function );
+        Synchronise( First );
+        return Removed;
     }
 
-    // Add a functor or function to the delegate if it isn't already added to the delegate.
-    template < typename T >
-    void AddUnique( T&& a_Function )
+    // Remove the invoker at the given index, keeping the broadcast cursor on the last invoker called.
+    void RemoveAt( size_t a_Index )
+    {
+        Detach( a_Index );
+        CompactSparse();
+    }
+
+    // Remove the invoker at the given index as RemoveAt, without compacting, so that removing many invokers can keep visiting the
+    // invocation list by index. Call CompactSparse once done.
+    void Detach( size_t a_Index )
     {
-        if ( std::find( m_Invokers.begin(), m_Invokers.end(), a_Function ) != m_Invokers.end() )
+        if constexpr ( !_Traits::StableOrder )
         {
-            return;
+            MoveCursors( a_Index, -1 );
         }
 
-        m_Invokers.emplace_back( std::forward< T >( a_Function ) );
+        Erase( a_Index );
     }
 
-    // Add an instance and member function to the delegate if it isn't already added to the delegate.
-    template < auto _Function, typename Object >
-    void AddUnique( Object* a_Object, MemberFunction< _Function > a_Function = MemberFunction< _Function >{} )
+    // Compact a delegate that keeps its order once more than half of its invocation list is tombstones, or if a broadcast left it
+    // with tombstones or skipped expired invokers.
+    void CompactSparse()
     {
-        if ( std::find( m_Invokers.begin(), m_Invokers.end(), InvokerType( a_Object, a_Function ) ) != m_Invokers.end() )
+        if constexpr ( _Traits::StableOrder )
         {
-            return;
+            if ( m_Tombstones * 2 > m_Invokers.size() )
+            {
+                Compact();
+                return;
+            }
         }
 
-        m_Invokers.emplace_back( a_Object, a_Function );
+        CompactPending();
     }
 
-    // Add a functor or function to the delegate if it isn't already added to the delegate, at the given index.
-    template < typename T >
-    void AddUnique( size_t a_Index, T&& a_Function )
+    // Remove the invoker at the given index, replacing it with the last invoker, or with a tombstone if the delegate keeps its
+    // order. During a broadcast the invokers after it are shifted down instead. Never compacts the invocation list.
+    void Erase( size_t a_Index )
     {
-        if ( std::find( m_Invokers.begin(), m_Invokers.end(), a_Function ) != m_Invokers.end() )
+        if constexpr ( _Traits::StableOrder )
+        {
+            if ( m_Flags[ a_Index ] & DelegateHelpers::Tombstone )
+            {
+                return;
+            }
+
+            // Unbound invokers call an empty invocation, so broadcasting needs no check to skip tombstones.
+            ReleaseSlot( a_Index );
+            m_Invokers[ a_Index ].Unbind();
+
+            if constexpr ( HasHandles )
+            {
+                m_Slots[ a_Index ] = UINT32_MAX;
+            }
+
+            m_Flags[ a_Index ] = DelegateHelpers::Tombstone;
+            ++m_Tombstones;
+            Synchronise( a_Index, a_Index + 1 );
+            return;
+        }
+
+        // Moving the last invoker during a broadcast would skip it, or call it again once the cursor reaches its new place.
+        if ( m_IsBroadcasting )
         {
+            EraseOrdered( a_Index );
             return;
         }
 
-        if ( m_IsBroadcasting && a_Index <= m_Index )
+        // The last invoker can only take the removed invoker's place if it has the same priority.
+        if constexpr ( HasPriorities )
+        {
+            if ( m_Priorities[ a_Index ] != m_Priorities.back() )
+            {
+                // Move the removed invoker to the end of its priority, and then to the end of each lower priority in turn.
+                size_t Hole = a_Index;
+                int32_t Priority = m_Priorities[ a_Index ];
+
+                for ( ;; )
+                {
+                    const size_t Last = std::partition_point( m_Priorities.begin() + Hole + 1, m_Priorities.end(), [&]( int32_t a_Other ) { return a_Other >= Priority; } ) - m_Priorities.begin() - 1;
+
+                    if ( Last != Hole )
+                    {
+                        Swap( Hole, Last );
+                        Hole = Last;
+                    }
+
+                    if ( Hole + 1 == m_Invokers.size() )
+                    {
+                        break;
+                    }
+
+                    Priority = m_Priorities[ Hole + 1 ];
+                }
+
+                a_Index = m_Invokers.size() - 1;
+            }
+        }
+
+        ReleaseSlot( a_Index );
+        m_Invokers.Swap( a_Index, m_Invokers.size() - 1 );
+        m_Invokers.pop_back();
+
+        if ( a_Index < m_Invokers.size() )
         {
-            ++m_Index;
+            MoveValues( m_Invokers.size(), a_Index );
         }
 
-        m_Invokers.emplace( m_Invokers.begin() + a_Index, std::forward< T >( a_Function ) );
+        ResizeValues( m_Invokers.size() );
+        Synchronise( a_Index, a_Index + 1 );
     }
 
-    // Add an instance and member function to the delegate if it isn't already added to the delegate, at the given index.
-    template < auto _Function, typename Object >
-    void AddUnique( size_t a_Index, Object* a_Object, MemberFunction< _Function > a_Function = MemberFunction< _Function >{} )
+    // Remove the invoker at the given index, shifting every invoker after it.
+    void EraseOrdered( size_t a_Index )
     {
-        if ( std::find( m_Invokers.begin(), m_Invokers.end(), InvokerType( a_Object, a_Function ) ) != m_Invokers.end() )
+        ReleaseSlot( a_Index );
+        m_Invokers.erase( m_Invokers.begin() + a_Index );
+
+        if constexpr ( HasFlags )
         {
-            return;
+            m_Flags.erase( m_Flags.begin() + a_Index );
+        }
+
+        if constexpr ( HasPriorities )
+        {
+            m_Priorities.erase( m_Priorities.begin() + a_Index );
         }
 
-        if ( m_IsBroadcasting && a_Index <= m_Index )
+        if constexpr ( HasHandles )
         {
-            ++m_Index;
+            m_Slots.erase( m_Slots.begin() + a_Index );
+            Reindex( a_Index );
         }
 
-        m_Invokers.emplace_back( a_Object, a_Function );
+        Synchronise( a_Index );
     }
 
-    // Remove a functor or function from the delegate.
-    template < typename T >
-    void Remove( T&& a_Function )
+    // Update the slots of the invokers from the given index onwards with their index. Tombstones have no slot.
+    void Reindex( size_t a_Index )
     {
-        auto Found = std::find( m_Invokers.begin(), m_Invokers.end(), a_Function );
-
-        if ( Found != m_Invokers.end() )
+        for ( size_t i = a_Index; i < m_Slots.size(); ++i )
         {
-            if ( m_IsBroadcasting && ( Found - m_Invokers.begin() ) <= m_Index )
+            if ( m_Slots[ i ] != UINT32_MAX )
             {
-                --m_Index;
+                m_SlotMap.Entries[ m_Slots[ i ] ].Index = static_cast< uint32_t >( i );
             }
-
-            *Found = m_Invokers.back();
-            m_Invokers.pop_back();
         }
     }
 
-    // Remove an instance and member function from the delegate.
-    template < auto _Function, typename Object >
-    void Remove( Object* a_Object, MemberFunction< _Function > a_Function = MemberFunction< _Function >{} )
+    // Exchange the invokers at two indices.
+    void Swap( size_t a_First, size_t a_Second )
     {
-        auto Found = std::find( m_Invokers.begin(), m_Invokers.end(), InvokerType( a_Object, a_Function ) );
+        m_Invokers.Swap( a_First, a_Second );
 
-        if ( Found != m_Invokers.end() )
+        if constexpr ( HasFlags )
         {
-            if ( m_IsBroadcasting && ( Found - m_Invokers.begin() ) <= m_Index )
-            {
-                --m_Index;
-            }
+            std::swap( m_Flags[ a_First ], m_Flags[ a_Second ] );
+        }
+
+        if constexpr ( HasPriorities )
+        {
+            std::swap( m_Priorities[ a_First ], m_Priorities[ a_Second ] );
+        }
 
-            *Found = m_Invokers.back();
-            m_Invokers.pop_back();
+        if constexpr ( HasHandles )
+        {
+            std::swap( m_Slots[ a_First ], m_Slots[ a_Second ] );
+            m_SlotMap.Entries[ m_Slots[ a_First ] ].Index = static_cast< uint32_t >( a_First );
+            m_SlotMap.Entries[ m_Slots[ a_Second ] ].Index = static_cast< uint32_t >( a_Second );
         }
+
+        Synchronise( a_First, a_First + 1 );
+        Synchronise( a_Second, a_Second + 1 );
     }
 
-    // Remove an invoker from the delegate at the given index.
-    void Remove( size_t a_Index )
+    // Record after a broadcast that listeners left tombstones during it, for the next add or remove to compact the invocation list.
+    // Broadcasts may be made through a const delegate, which must not be modified. Expired invokers skipped by the broadcast are
+    // recorded by SkipExpired the same way.
+    void DeferCompaction() const
     {
-        if ( m_IsBroadcasting && a_Index <= m_Index )
+        if constexpr ( _Traits::StableOrder )
         {
-            --m_Index;
+            m_IsCompactPending = m_Tombstones != 0;
         }
-
-        m_Invokers[ a_Index ] = m_Invokers.back();
-        m_Invokers.pop_back();
     }
 
-    // Remove all invokers from the delegate that match the given functor or function.
-    template < typename T >
-    void RemoveAll( T&& a_Function )
+    // Compact the invocation list if a broadcast left it with tombstones or skipped expired invokers.
+    void CompactPending()
     {
-        for ( int32_t i = m_Invokers.size() - 1; i > m_Index; --i )
+        if constexpr ( _Traits::StableOrder || _Traits::WeakTargets )
         {
-            if ( m_Invokers[ i ] == a_Function )
+            if ( m_IsCompactPending || HasExpired() )
             {
-                m_Invokers[ i ] = m_Invokers.back();
-                m_Invokers.pop_back();
+                Compact();
             }
         }
+    }
 
-        for ( int32_t i = m_Index; i >= 0; --i )
+    // Give every invoker a new slot, after the slots were moved to another delegate.
+    void ResetSlots()
+    {
+        if constexpr ( HasHandles )
         {
-            if ( m_Invokers[ i ] == a_Function )
+            m_Slots.clear();
+            m_SlotMap.Clear();
+            Unindex();
+            ClearLifetimes();
+
+            for ( size_t i = 0; i < m_Invokers.size(); ++i )
             {
-                m_Invokers[ i ] = m_Invokers.back();
-                m_Invokers.pop_back();
-                --m_Index;
+                m_Slots.push_back( m_SlotMap.Acquire( i ) );
+                Index( i );
             }
         }
     }
 
-    // Remove all invokers from the delegate that match the given instance and member function.
-    template < auto _Function, typename Object >
-    void RemoveAll( Object* a_Object, MemberFunction< _Function > a_Function = MemberFunction< _Function >{} )
+    // Move the flags, priority and slot of the invoker at a_From to a_To, as the invoker itself was moved.
+    void MoveValues( size_t a_From, size_t a_To )
     {
-        InvokerType Check( a_Object, a_Function );
+        if constexpr ( HasFlags )
+        {
+            m_Flags[ a_To ] = m_Flags[ a_From ];
+        }
 
-        for ( uint32_t i = m_Invokers.size() - 1; i > m_Index; --i )
+        if constexpr ( HasPriorities )
         {
-            if ( m_Invokers[ i ] == Check )
-            {
-                m_Invokers[ i ] = m_Invokers.back();
-                m_Invokers.pop_back();
-            }
+            m_Priorities[ a_To ] = m_Priorities[ a_From ];
         }
 
-        for ( uint32_t i = m_Index; i >= 0; --i )
+        if constexpr ( HasHandles )
         {
-            if ( m_Invokers[ i ] == Check )
+            m_Slots[ a_To ] = m_Slots[ a_From ];
+
+            if ( m_Slots[ a_To ] != UINT32_MAX )
             {
-                m_Invokers[ i ] = m_Invokers.back();
-                m_Invokers.pop_back();
-                --m_Index;
+                m_SlotMap.Entries[ m_Slots[ a_To ] ].Index = static_cast< uint32_t >( a_To );
             }
         }
     }
 
-    // Call all contained invokers with the given arguments. _Safe set to true will call invokers safely.
-    template < bool _Safe = false >
-    void Broadcast( Args... a_Args ) const
+    // Keep the flags, priorities and slots of the first a_Count invokers.
+    void ResizeValues( size_t a_Count )
     {
-        if ( m_IsBroadcasting )
+        if constexpr ( HasFlags )
         {
-            return;
+            m_Flags.resize( a_Count );
         }
 
-        m_IsBroadcasting = true;
-        m_Index = 0;
+        if constexpr ( HasPriorities )
+        {
+            m_Priorities.resize( a_Count );
+        }
 
-        for ( ; m_Index < m_Invokers.size(); ++m_Index )
+        if constexpr ( HasHandles )
         {
-            ( void )m_Invokers[ m_Index ].InvokeSafe( std::forward< Args >( a_Args )... );
+            m_Slots.resize( a_Count );
         }
+    }
 
-        m_IsBroadcasting = false;
-        m_Index = -1;
+    // Is the invoker at the given index the tombstone of a removed invoker?
+    bool IsTombstone( size_t a_Index ) const
+    {
+        if constexpr ( _Traits::StableOrder )
+        {
+            return m_Flags[ a_Index ] & DelegateHelpers::Tombstone;
+        }
+        else
+        {
+            return false;
+        }
     }
 
-    // Call all contained invokers with the given arguments. Invokers will be called unsafely.
-    void operator()( Args... a_Args ) const
+    // Call a_Function( Invoker, Index ) for every invoker, parallel safe invokers on a_Pool after the others on this thread, then
+    // resume awaiting coroutines with a_Args.
+    template < typename _Pool, typename Function, typename... T >
+    void ForEachParallel( _Pool& a_Pool, size_t a_Grain, Function&& a_Function, T&... a_Args ) const
     {
+        static_assert( _Traits::ParallelBroadcast, "Parallel broadcasts require a delegate with the ParallelBroadcast trait." );
+        static_assert( ( !std::is_rvalue_reference_v< InvokerHelpers::ParameterType< Args > > && ... ), "Arguments passed by rvalue reference cannot be shared between threads." );
+
         if ( m_IsBroadcasting )
         {
             return;
         }
 
         m_IsBroadcasting = true;
-        m_Index = 0;
 
-        for ( ; m_Index < m_Invokers.size(); ++m_Index )
+        try
+        {
+            RunBroadcast( [&]
+            {
+                // Expired invokers are found here, parallel safe ones included, so that workers only read the delegate.
+                for ( size_t i = 0; i < m_Invokers.size(); ++i )
+                {
+                    if ( !SkipExpired( i ) && !( m_Flags[ i ] & DelegateHelpers::ParallelSafe ) )
+                    {
+                        Call( i, [&] { a_Function( m_Invokers[ i ], i ); } );
+                    }
+                }
+
+                a_Pool.ParallelFor( m_Invokers.size(), a_Grain, [&]( size_t a_Begin, size_t a_End )
+                {
+                    for ( size_t i = a_Begin; i < a_End; ++i )
+                    {
+                        if ( ( m_Flags[ i ] & DelegateHelpers::ParallelSafe ) && !IsExpired( i ) )
+                        {
+                            Call( i, [&] { a_Function( m_Invokers[ i ], i ); } );
+                        }
+                    }
+                } );
+            } );
+        }
+        catch ( ... )
         {
-            ( void )m_Invokers[ m_Index ].InvokeSafe( std::forward< Args >( a_Args )... );
+            m_IsBroadcasting = false;
+            throw;
         }
 
         m_IsBroadcasting = false;
-        m_Index = -1;
+
+        DeferCompaction();
+        ResumeAwaiters( a_Args... );
     }
 
-    // Clear the delegate.
-    inline void Clear() { m_Invokers.clear(); m_Index = -1; }
+    // Update the dispatch table for the invokers in [a_Index, a_End).
+    void Synchronise( size_t a_Index, size_t a_End = SIZE_MAX ) const
+    {
+        if constexpr ( _Traits::StructureOfArrays )
+        {
+            m_Table.Functions.resize( m_Invokers.size() );
+            m_Table.Objects.resize( m_Invokers.size() );
 
-    // Is the delegate currently broadcasting.
-    inline bool IsBroadcasting() const { return m_IsBroadcasting; }
+            const size_t End = std::min( a_End, m_Invokers.size() );
 
-    // The count of stored invokers.
-    inline size_t Size() const { return m_Invokers.size(); }
+            for ( size_t i = a_Index; i < End; ++i )
+            {
+                m_Table.Functions[ i ] = m_Invokers[ i ].m_Function;
+                m_Table.Objects[ i ] = m_Invokers[ i ].m_Object;
+            }
 
-    // Is this delegate empty?
-    inline bool Empty() const { return m_Invokers.empty(); }
+            m_Table.IsDirty &= a_Index != 0 || a_End < m_Invokers.size();
+            m_Table.IsRunsDirty = true;
+            ++m_Table.Version;
+        }
+    }
 
-    // Get the collection of all invokers.
-    inline const ContainerType& GetInvocationList() const { return m_Invokers; }
+    // Rebuild the runs of identical batchable thunks if the table has changed. Returns the table version they are valid for.
+    uint32_t BuildRuns() const
+    {
+        if constexpr ( IsBatched )
+        {
+            if ( m_Table.IsRunsDirty )
+            {
+                m_Table.Runs.resize( m_Table.Functions.size() );
+                m_Table.Batches.resize( m_Table.Functions.size() );
+
+                for ( size_t i = m_Table.Functions.size(); i-- > 0; )
+                {
+                    // Weak invokers are called one at a time, so that each is checked for expiry.
+                    if ( IsWeak( i ) )
+                    {
+                        m_Table.Batches[ i ] = nullptr;
+                        m_Table.Runs[ i ] = 1;
+                        continue;
+                    }
+
+                    if ( i + 1 < m_Table.Functions.size() && m_Table.Functions[ i ] == m_Table.Functions[ i + 1 ] && !IsWeak( i + 1 ) )
+                    {
+                        // Runs without a batch thunk are called one invoker at a time.
+                        m_Table.Batches[ i ] = m_Table.Batches[ i + 1 ];
+                        m_Table.Runs[ i ] = m_Table.Batches[ i ] ? m_Table.Runs[ i + 1 ] + 1 : 1;
+                        continue;
+                    }
+
+                    auto Found = std::find_if( m_Table.Registry.begin(), m_Table.Registry.end(), [&]( const auto& a_Entry ) { return a_Entry.first == m_Table.Functions[ i ]; } );
+                    m_Table.Batches[ i ] = Found != m_Table.Registry.end() ? Found->second : nullptr;
+                    m_Table.Runs[ i ] = 1;
+                }
+
+                m_Table.IsRunsDirty = false;
+            }
 
-    // Get begin iterator.
-    inline IteratorType Begin() { return m_Invokers.begin(); }
+            return m_Table.Version;
+        }
+        else
+        {
+            return 0;
+        }
+    }
 
-    // Get begin iterator.
-    inline CIteratorType Begin() const { return m_Invokers.begin(); }
+    // Record the batch thunk for a member function added to the delegate.
+    template < auto _Function >
+    void Register()
+    {
+        if constexpr ( _Traits::BatchDispatch )
+        {
+            FunctionType Function = InvokerType::template Invocation< _Function >;
 
-    // Get begin iterator.
-    inline CIteratorType CBegin() const { return m_Invokers.cbegin(); }
+            if ( std::find_if( m_Table.Registry.begin(), m_Table.Registry.end(), [&]( const auto& a_Entry ) { return a_Entry.first == Function; } ) == m_Table.Registry.end() )
+            {
+                m_Table.Registry.emplace_back( Function, BatchInvocation< _Function > );
+            }
+        }
+    }
 
-    // Get reverse begin iterator.
-    inline RIteratorType RBegin() { return m_Invokers.rbegin(); }
+    // Take the batch thunks known to another delegate.
+    void CopyRegistry( const BasicDelegate& a_Delegate )
+    {
+        if constexpr ( _Traits::BatchDispatch )
+        {
+            m_Table.Registry = a_Delegate.m_Table.Registry;
+        }
+    }
 
-    // Get reverse begin iterator.
-    inline CRIteratorType RBegin() const { return m_Invokers.rbegin(); }
+    // Call a member function on each object in [a_Cursor, a_End) without an indirect call per object. a_Cursor is the delegate's
+    // broadcast index, kept current so that listeners adding and removing invokers adjust it as usual. Stops after the current
+    // object if a listener modifies the delegate, leaving the cursor on the last object called.
+    template < auto _Function >
+    static void BatchInvocation( void* const* a_Objects, int32_t& a_Cursor, int32_t a_End, const uint32_t& a_Version, InvokerHelpers::ParameterType< Args >... a_Args )
+    {
+        const uint32_t Version = a_Version;
 
-    // Get reverse begin iterator.
-    inline CRIteratorType CRBegin() const { return m_Invokers.crbegin(); }
+        for ( ;; )
+        {
+            ( void )InvokerType::template Invocation< _Function >( a_Objects[ a_Cursor ], std::forward< InvokerHelpers::ParameterType< Args > >( a_Args )... );
 
-    // Get end iterator.
-    inline IteratorType End() { return m_Invokers.end(); }
+            if ( a_Version != Version || a_Cursor + 1 == a_End )
+            {
+                return;
+            }
 
-    // Get end iterator.
-    inline CIteratorType End() const { return m_Invokers.end(); }
+            ++a_Cursor;
+        }
+    }
 
-    // Get end iterator.
-    inline CIteratorType CEnd() const { return m_Invokers.cend(); }
+    // Mark the dispatch table as stale after handing out mutable access to the invokers.
+    void Invalidate()
+    {
+        if constexpr ( _Traits::StructureOfArrays )
+        {
+            m_Table.IsDirty = true;
+            ++m_Table.Version;
+        }
+    }
 
-    // Get reverse end iterator.
-    inline RIteratorType REnd() { return m_Invokers.rend(); }
+    ContainerType                         m_Invokers;
+    FlagContainerType                     m_Flags;
+    PriorityContainerType                 m_Priorities;
+    SlotContainerType                     m_Slots;
+    SlotMapType                           m_SlotMap;
+    LookupType                            m_Lookup;
+    ObjectLookupType                      m_Objects;
+    mutable LifetimeTableType             m_Lifetimes;
+    mutable TableType                     m_Table;
+    mutable InstrumentationType           m_Statistics;
+    size_t                                m_Tombstones;
+    mutable bool                          m_IsCompactPending;
+    const char*                           m_Name;
+    ConsumerType                          m_Consumer;
+    mutable PendingQueueType              m_Pending;
+    mutable DelegateReentrancyCounters    m_Reentrancy;
+    mutable bool                          m_IsBroadcasting;
+    mutable int32_t                       m_Index;
+    mutable bool                          m_IsCursorRemoved;
+    mutable DelegateHelpers::CursorFrame* m_Outer;
+
+#if CALLABLE_COROUTINES
+    mutable AwaiterListType m_Awaiters;
+#endif
+};
 
-    // Get reverse end iterator.
-    inline CRIteratorType REnd() const { return m_Invokers.rend(); }
+// Remove every invoker bound to the given object from each of the given delegates, as when tearing down an object that listens to
+// several events. Returns how many invokers were removed in total.
+template < typename Object, typename... Delegates >
+size_t RemoveObject( Object* a_Object, Delegates&... a_Delegates )
+{
+    static_assert( ( std::is_delegate_v< Delegates > && ... ), "RemoveObject takes delegates." );
+    return ( a_Delegates.RemoveObject( a_Object ) + ... + size_t( 0 ) );
+}
 
-    // Get reverse end iterator.
-    inline CRIteratorType CREnd() const { return m_Invokers.crend(); }
+//==========================================================================
+// A scoped subscription removes an invoker from its delegate when it is
+// destroyed, by handle and without searching the invocation list.
+//==========================================================================
+template < typename _Delegate >
+class ScopedSubscription
+{
+public:
 
-    // Copy from another delegate.
-    Delegate& operator=( const Delegate& a_Delegate )
+    // Create an empty subscription.
+    ScopedSubscription()
+        : m_Delegate( nullptr )
+    {}
+
+    // Take ownership of the invoker a_Handle refers to in a_Delegate.
+    ScopedSubscription( _Delegate& a_Delegate, DelegateHandle a_Handle )
+        : m_Delegate( &a_Delegate )
+        , m_Handle( a_Handle )
+    {}
+
+    ScopedSubscription( const ScopedSubscription& ) = delete;
+    ScopedSubscription& operator=( const ScopedSubscription& ) = delete;
+
+    // Moves from a provided subscription.
+    ScopedSubscription( ScopedSubscription&& a_Subscription )
+        : m_Delegate( a_Subscription.m_Delegate )
+        , m_Handle( a_Subscription.m_Handle )
     {
-        m_Invokers = a_Delegate.m_Invokers;
-        m_IsBroadcasting = false;
-        m_Index = -1;
-        return *this;
+        a_Subscription.m_Delegate = nullptr;
     }
 
-    // Move from another delegate.
-    Delegate& operator=( Delegate&& a_Delegate )
+    // Remove the owned invoker and move from a provided subscription.
+    ScopedSubscription& operator=( ScopedSubscription&& a_Subscription )
     {
-        m_Invokers = std::move( a_Delegate.m_Invokers );
-        m_IsBroadcasting = false;
-        m_Index = -1;
-        a_Delegate.m_Index = -1;
+        if ( this != &a_Subscription )
+        {
+            Reset();
+            m_Delegate = a_Subscription.m_Delegate;
+            m_Handle = a_Subscription.m_Handle;
+            a_Subscription.m_Delegate = nullptr;
+        }
+
         return *this;
     }
 
-    // Add a functor or function object to the delegate.
-    template < typename T >
-    inline Delegate& operator+=( T&& a_Function ) { Add( std::forward< T >( a_Function ) ); return *this; }
+    ~ScopedSubscription() { Reset(); }
 
-    // Remove a functor or function object to the delegate.
-    template < typename T >
-    inline Delegate& operator-=( T&& a_Function ) { Remove( std::forward< T >( a_Function ) ); return *this; }
+    // Remove the owned invoker from its delegate.
+    void Reset()
+    {
+        if ( m_Delegate )
+        {
+            m_Delegate->Remove( m_Handle );
+            m_Delegate = nullptr;
+        }
+    }
 
-    // Get the stored invoker at a given index.
-    template < typename T >
-    inline InvokerType& operator[]( size_t a_Index ) { return m_Invokers[ a_Index ]; }
+    // Give up ownership of the invoker, leaving it in the delegate, and return its handle.
+    DelegateHandle Release()
+    {
+        m_Delegate = nullptr;
+        return m_Handle;
+    }
 
-    // Get the stored invoker at a given index.
-    template < typename T >
-    inline const InvokerType& operator[]( size_t a_Index ) const { return m_Invokers[ a_Index ]; }
+    // Get the handle of the owned invoker.
+    DelegateHandle GetHandle() const { return m_Handle; }
+
+    // Does the subscription own an invoker?
+    explicit operator bool() const { return m_Delegate != nullptr; }
 
 private:
 
-    ContainerType   m_Invokers;
-    mutable bool    m_IsBroadcasting;
-    mutable int32_t m_Index;
+    _Delegate*     m_Delegate;
+    DelegateHandle m_Handle;
 };
 
 namespace std
@@ -408,18 +3501,18 @@ namespace std
         return std::move( as_delegate_t< FunctionType >() += as_invoker_t< FunctionType >( forward< T >( a_Object ), a_Function ) );
     }
 
-    template < typename Return, typename... Args > auto empty( const Delegate< Return, Args... >& a_Delegate ) { return a_Delegate.Empty(); }
-    template < typename Return, typename... Args > auto size( const Delegate< Return, Args... >& a_Delegate ) { return a_Delegate.Size(); }
-    template < typename Return, typename... Args > auto begin( Delegate< Return, Args... >& a_Delegate ) { return a_Delegate.Begin(); }
-    template < typename Return, typename... Args > auto begin( const Delegate< Return, Args... >& a_Delegate ) { return a_Delegate.Begin(); }
-    template < typename Return, typename... Args > auto cbegin( const Delegate< Return, Args... >& a_Delegate ) { return a_Delegate.CBegin(); }
-    template < typename Return, typename... Args > auto rbegin( Delegate< Return, Args... >& a_Delegate ) { return a_Delegate.RBegin(); }
-    template < typename Return, typename... Args > auto rbegin( const Delegate< Return, Args... >& a_Delegate ) { return a_Delegate.RBegin(); }
-    template < typename Return, typename... Args > auto crbegin( const Delegate< Return, Args... >& a_Delegate ) { return a_Delegate.CRBegin(); }
-    template < typename Return, typename... Args > auto end( Delegate< Return, Args... >& a_Delegate ) { return a_Delegate.End(); }
-    template < typename Return, typename... Args > auto end( const Delegate< Return, Args... >& a_Delegate ) { return a_Delegate.End(); }
-    template < typename Return, typename... Args > auto cend( const Delegate< Return, Args... >& a_Delegate ) { return a_Delegate.CEnd(); }
-    template < typename Return, typename... Args > auto rend( Delegate< Return, Args... >& a_Delegate ) { return a_Delegate.REnd(); }
-    template < typename Return, typename... Args > auto rend( const Delegate< Return, Args... >& a_Delegate ) { return a_Delegate.REnd(); }
-    template < typename Return, typename... Args > auto crend( const Delegate< Return, Args... >& a_Delegate ) { return a_Delegate.CREnd(); }
+    template < typename _Traits, typename Return, typename... Args > auto empty( const BasicDelegate< _Traits, Return, Args... >& a_Delegate ) { return a_Delegate.Empty(); }
+    template < typename _Traits, typename Return, typename... Args > auto size( const BasicDelegate< _Traits, Return, Args... >& a_Delegate ) { return a_Delegate.Size(); }
+    template < typename _Traits, typename Return, typename... Args > auto begin( BasicDelegate< _Traits, Return, Args... >& a_Delegate ) { return a_Delegate.Begin(); }
+    template < typename _Traits, typename Return, typename... Args > auto begin( const BasicDelegate< _Traits, Return, Args... >& a_Delegate ) { return a_Delegate.Begin(); }
+    template < typename _Traits, typename Return, typename... Args > auto cbegin( const BasicDelegate< _Traits, Return, Args... >& a_Delegate ) { return a_Delegate.CBegin(); }
+    template < typename _Traits, typename Return, typename... Args > auto rbegin( BasicDelegate< _Traits, Return, Args... >& a_Delegate ) { return a_Delegate.RBegin(); }
+    template < typename _Traits, typename Return, typename... Args > auto rbegin( const BasicDelegate< _Traits, Return, Args... >& a_Delegate ) { return a_Delegate.RBegin(); }
+    template < typename _Traits, typename Return, typename... Args > auto crbegin( const BasicDelegate< _Traits, Return, Args... >& a_Delegate ) { return a_Delegate.CRBegin(); }
+    template < typename _Traits, typename Return, typename... Args > auto end( BasicDelegate< _Traits, Return, Args... >& a_Delegate ) { return a_Delegate.End(); }
+    template < typename _Traits, typename Return, typename... Args > auto end( const BasicDelegate< _Traits, Return, Args... >& a_Delegate ) { return a_Delegate.End(); }
+    template < typename _Traits, typename Return, typename... Args > auto cend( const BasicDelegate< _Traits, Return, Args... >& a_Delegate ) { return a_Delegate.CEnd(); }
+    template < typename _Traits, typename Return, typename... Args > auto rend( BasicDelegate< _Traits, Return, Args... >& a_Delegate ) { return a_Delegate.REnd(); }
+    template < typename _Traits, typename Return, typename... Args > auto rend( const BasicDelegate< _Traits, Return, Args... >& a_Delegate ) { return a_Delegate.REnd(); }
+    template < typename _Traits, typename Return, typename... Args > auto crend( const BasicDelegate< _Traits, Return, Args... >& a_Delegate ) { return a_Delegate.CREnd(); }
 }
\ No newline at end of file
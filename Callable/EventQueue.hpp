@@ -0,0 +1,254 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <tuple>
+#include <utility>
+
+#include "Delegate.hpp"
+
+// Helpers for event queue types.
+namespace EventQueueHelpers
+{
+    // Contiguous ring buffer of T with a power of two capacity, grown by doubling when full.
+    template < typename T, typename _Allocator >
+    class RingBuffer
+    {
+    private:
+
+        using AllocatorType = typename std::allocator_traits< _Allocator >::template rebind_alloc< T >;
+        using AllocatorTraits = std::allocator_traits< AllocatorType >;
+
+    public:
+
+        // Forward iterator over the elements, from front to back.
+        class Iterator
+        {
+        public:
+
+            Iterator( RingBuffer& a_Buffer, size_t a_Index ) : m_Buffer( &a_Buffer ), m_Index( a_Index ) {}
+
+            T& operator*() const { return ( *m_Buffer )[ m_Index ]; }
+            Iterator& operator++() { ++m_Index; return *this; }
+            bool operator==( const Iterator& a_Other ) const { return m_Index == a_Other.m_Index; }
+            bool operator!=( const Iterator& a_Other ) const { return m_Index != a_Other.m_Index; }
+
+        private:
+
+            RingBuffer* m_Buffer;
+            size_t      m_Index;
+        };
+
+        explicit RingBuffer( const _Allocator& a_Allocator )
+            : m_Allocator( a_Allocator )
+            , m_Data( nullptr )
+            , m_Capacity( 0 )
+            , m_Head( 0 )
+            , m_Size( 0 )
+        {}
+
+        RingBuffer( const RingBuffer& ) = delete;
+        RingBuffer& operator=( const RingBuffer& ) = delete;
+
+        ~RingBuffer()
+        {
+            Clear();
+
+            if ( m_Data )
+            {
+                AllocatorTraits::deallocate( m_Allocator, m_Data, m_Capacity );
+            }
+        }
+
+        // Construct an element at the back of the buffer.
+        template < typename... Args >
+        void Push( Args&&... a_Args )
+        {
+            if ( m_Size == m_Capacity )
+            {
+                Reserve( m_Capacity ? m_Capacity * 2 : 16 );
+            }
+
+            AllocatorTraits::construct( m_Allocator, m_Data + ( ( m_Head + m_Size ) & ( m_Capacity - 1 ) ), std::forward< Args >( a_Args )... );
+            ++m_Size;
+        }
+
+        // Destroy the first a_Count elements.
+        void Pop( size_t a_Count )
+        {
+            for ( ; a_Count; --a_Count, --m_Size )
+            {
+                AllocatorTraits::destroy( m_Allocator, m_Data + m_Head );
+                m_Head = ( m_Head + 1 ) & ( m_Capacity - 1 );
+            }
+        }
+
+        // Destroy all elements.
+        void Clear() { Pop( m_Size ); m_Head = 0; }
+
+        // Make room for at least a_Capacity elements, rounded up to a power of two.
+        void Reserve( size_t a_Capacity )
+        {
+            if ( a_Capacity <= m_Capacity )
+            {
+                return;
+            }
+
+            size_t Capacity = m_Capacity ? m_Capacity : 1;
+
+            while ( Capacity < a_Capacity )
+            {
+                Capacity *= 2;
+            }
+
+            T* Data = AllocatorTraits::allocate( m_Allocator, Capacity );
+
+            for ( size_t i = 0; i < m_Size; ++i )
+            {
+                T& Element = ( *this )[ i ];
+                AllocatorTraits::construct( m_Allocator, Data + i, std::move_if_noexcept( Element ) );
+                AllocatorTraits::destroy( m_Allocator, &Element );
+            }
+
+            if ( m_Data )
+            {
+                AllocatorTraits::deallocate( m_Allocator, m_Data, m_Capacity );
+            }
+
+            m_Data = Data;
+            m_Capacity = Capacity;
+            m_Head = 0;
+        }
+
+        // Exchange contents with another buffer using an equal allocator.
+        void Swap( RingBuffer& a_Other )
+        {
+            std::swap( m_Data, a_Other.m_Data );
+            std::swap( m_Capacity, a_Other.m_Capacity );
+            std::swap( m_Head, a_Other.m_Head );
+            std::swap( m_Size, a_Other.m_Size );
+        }
+
+        // Get the element a_Index places from the front.
+        T& operator[]( size_t a_Index ) { return m_Data[ ( m_Head + a_Index ) & ( m_Capacity - 1 ) ]; }
+
+        size_t Size() const { return m_Size; }
+        size_t Capacity() const { return m_Capacity; }
+
+        Iterator Begin() { return Iterator( *this, 0 ); }
+        Iterator End() { return Iterator( *this, m_Size ); }
+
+    private:
+
+        AllocatorType m_Allocator;
+        T*            m_Data;
+        size_t        m_Capacity;
+        size_t        m_Head;
+        size_t        m_Size;
+    };
+}
+
+template < typename _Delegate >
+class EventQueue;
+
+//==========================================================================
+// An event queue records broadcasts of a delegate to be dispatched later.
+// Enqueue stores the arguments of a broadcast in a contiguous ring buffer,
+// and Drain dispatches every queued event at once, as one broadcast of the
+// delegate. Each invoker is called for all drained events before the next
+// invoker, so listeners run back to back over the batch. Arguments are
+// stored by value.
+//==========================================================================
+template < typename _Traits, typename Return, typename... Args >
+class EventQueue< BasicDelegate< _Traits, Return, Args... > >
+{
+private:
+
+    using DelegateType = BasicDelegate< _Traits, Return, Args... >;
+    using EventType = std::tuple< std::decay_t< Args >... >;
+    using BufferType = EventQueueHelpers::RingBuffer< EventType, decltype( std::declval< DelegateType >().GetAllocator() ) >;
+
+    static_assert( ( !std::is_rvalue_reference_v< InvokerHelpers::ParameterType< Args > > && ... ), "Queued events are dispatched to every listener, so arguments cannot be passed by rvalue reference." );
+
+public:
+
+    // Create a queue of events for a_Delegate, which must outlive the queue.
+    explicit EventQueue( const DelegateType& a_Delegate, size_t a_Capacity = 0 )
+        : m_Delegate( a_Delegate )
+        , m_Events( a_Delegate.GetAllocator() )
+        , m_Draining( a_Delegate.GetAllocator() )
+        , m_IsDraining( false )
+    {
+        m_Events.Reserve( a_Capacity );
+    }
+
+    EventQueue( const EventQueue& ) = delete;
+    EventQueue& operator=( const EventQueue& ) = delete;
+
+    // Record a broadcast with the given arguments.
+    template < typename... T >
+    void Enqueue( T&&... a_Args )
+    {
+        static_assert( sizeof...( T ) == sizeof...( Args ), "Enqueue takes one value per delegate argument." );
+        m_Events.Push( std::forward< T >( a_Args )... );
+    }
+
+    // Dispatch all queued events through the delegate's BroadcastBatch and return how many were dispatched. Events enqueued by
+    // listeners during the drain are kept for the next one. Listeners added during the drain are called as by Broadcast, listeners
+    // removed during the drain receive none of the remaining events, and expired weak invokers are skipped. Draining from
+    // a listener of the same queue does nothing, and draining from a listener of the delegate's own broadcast dispatches each event
+    // as a broadcast started by a listener.
+    size_t Drain()
+    {
+        if ( m_IsDraining || m_Events.Size() == 0 )
+        {
+            return 0;
+        }
+
+        // Take the queued events so that listeners can enqueue without moving the events being dispatched.
+        m_IsDraining = true;
+        m_Draining.Swap( m_Events );
+
+        const size_t Count = m_Draining.Size();
+
+        try
+        {
+            m_Delegate.BroadcastBatch( m_Draining.Begin(), m_Draining.End() );
+        }
+        catch ( ... )
+        {
+            m_Draining.Clear();
+            m_IsDraining = false;
+            throw;
+        }
+
+        m_Draining.Clear();
+
+        // Keep the larger buffer for enqueueing, unless listeners have already started refilling the other one.
+        if ( m_Events.Size() == 0 && m_Draining.Capacity() > m_Events.Capacity() )
+        {
+            m_Events.Swap( m_Draining );
+        }
+
+        m_IsDraining = false;
+        return Count;
+    }
+
+    // Discard all queued events.
+    void Clear() { m_Events.Clear(); }
+
+    // The count of queued events.
+    size_t Size() const { return m_Events.Size(); }
+
+    // Is the queue empty?
+    bool Empty() const { return m_Events.Size() == 0; }
+
+    // Get the delegate events are dispatched to.
+    const DelegateType& GetDelegate() const { return m_Delegate; }
+
+private:
+
+    const DelegateType& m_Delegate;
+    BufferType          m_Events;
+    BufferType          m_Draining;
+    bool                m_IsDraining;
+};
@@ -1,18 +1,67 @@
 #pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <new>
 #include <vector>
 
 #include "function_traits.hpp"
 
-template < typename Return, typename... Args >
-class Invoker;
+// Tracing is compiled out unless CALLABLE_TRACING is defined as 1, see Trace.hpp.
+#ifndef CALLABLE_TRACING
+#define CALLABLE_TRACING 0
+#endif
+
+#if CALLABLE_TRACING
+#include "Trace.hpp"
+#endif
+
+// Storage configuration for an invoker. Callables no larger than _Capacity, no more aligned than _Alignment and nothrow move
+// constructible are stored inline within the invoker. Larger callables are allocated with _Allocator. A _Capacity of 0 disables
+// inline storage. Invokers with _Copyable storage can be copied, otherwise they are move-only and accept move-only callables.
+// An invoker is three pointers, its object, thunk and storage manager, followed by the buffer: 40 bytes with the default capacity
+// on 64-bit targets, and 24 without inline storage. The buffer saves an allocation per bind and copy of a small callable.
+template < size_t _Capacity = 2 * sizeof( void* ), size_t _Alignment = alignof( void* ), typename _Allocator = std::allocator< std::byte >, bool _Copyable = true >
+struct InvokerStorage
+{
+    static constexpr size_t Capacity = _Capacity;
+    static constexpr size_t Alignment = _Alignment;
+    static constexpr bool Copyable = _Copyable;
+    using AllocatorType = _Allocator;
+};
+
+// Invoker storage that allocates from a std::pmr::memory_resource, such as a monotonic arena or a pool.
+using PmrInvokerStorage = InvokerStorage< 2 * sizeof( void* ), alignof( void* ), std::pmr::polymorphic_allocator< std::byte > >;
+
+// Invoker storage for move-only invokers, which bind callables with move-only captures. Their storage managers only move and
+// destroy the callable, and never instantiate Copy. They share the manager pointer with copyable invokers, so both are the same
+// size, and a delegate never moves its invokers once added.
+using UniqueInvokerStorage = InvokerStorage< 2 * sizeof( void* ), alignof( void* ), std::allocator< std::byte >, false >;
+
+template < typename _Storage, typename Return, typename... Args >
+class BasicInvoker;
+
+template < typename Return = void, typename... Args >
+using Invoker = BasicInvoker< InvokerStorage<>, Return, Args... >;
+
+template < typename Return = void, typename... Args >
+using PmrInvoker = BasicInvoker< PmrInvokerStorage, Return, Args... >;
+
+template < typename Return = void, typename... Args >
+using UniqueInvoker = BasicInvoker< UniqueInvokerStorage, Return, Args... >;
 
 namespace std
 {
     template < typename T >
     struct is_invoker : public std::false_type {};
 
-    template < typename Return, typename... Args >
-    struct is_invoker< Invoker< Return, Args... > > : public std::true_type {};
+    template < typename _Storage, typename Return, typename... Args >
+    struct is_invoker< BasicInvoker< _Storage, Return, Args... > > : public std::true_type {};
 
     template < typename T >
     static constexpr bool is_invoker_v = is_invoker< T >::value;
@@ -20,8 +69,8 @@ namespace std
     template < typename T >
     struct is_action : public std::false_type {};
 
-    template < typename... Args >
-    struct is_action< Invoker< void, Args... > > : public std::true_type {};
+    template < typename _Storage, typename... Args >
+    struct is_action< BasicInvoker< _Storage, void, Args... > > : public std::true_type {};
 
     template < typename T >
     static constexpr bool is_action_v = is_action< T >::value;
@@ -29,8 +78,8 @@ namespace std
     template < typename T >
     struct is_predicate : public std::false_type {};
 
-    template < typename... Args >
-    struct is_predicate< Invoker< bool, Args... > > : public std::true_type {};
+    template < typename _Storage, typename... Args >
+    struct is_predicate< BasicInvoker< _Storage, bool, Args... > > : public std::true_type {};
 
     template < typename T >
     static constexpr bool is_predicate_v = is_predicate< T >::value;
@@ -44,8 +93,8 @@ namespace std
     template < typename Return, typename... Args >
     struct as_invoker< Return( Args... ) > { using type = Invoker< Return, Args... >; };
 
-    template < typename Return, typename... Args >
-    struct as_invoker< Invoker< Return, Args... > > { using type = Invoker< Return, Args... >; };
+    template < typename _Storage, typename Return, typename... Args >
+    struct as_invoker< BasicInvoker< _Storage, Return, Args... > > { using type = BasicInvoker< _Storage, Return, Args... >; };
 
     template < typename T >
     using as_invoker_t = typename as_invoker< T >::type;
@@ -62,73 +111,403 @@ struct MemberFunction
     using SignatureType = typename TraitsType::signature_type;
 };
 
+// Static storage object for a free function. Binding it calls the function through a compile time thunk, and invokers can be
+// constructed from it in constant expressions. Use as FreeFunction<&Function>{}.
+template < auto _Function >
+struct FreeFunction
+{
+    using TraitsType = std::function_traits< decltype( _Function ) >;
+    using ReturnType = typename TraitsType::return_type;
+    using ArgumentsType = typename TraitsType::arguments_type;
+    using SignatureType = typename TraitsType::signature_type;
+};
+
+// Wraps a callable so that it is bound in shared ownership mode. Copies of an invoker bound to a shared function share one
+// reference counted instance of the callable instead of copying it. _Atomic selects thread safe reference counting.
+// Use as SharedFunction( callable ) or std::make_shared_function< false >( callable ).
+template < typename T, bool _Atomic = true >
+struct SharedFunction
+{
+    using CallableType = T;
+    static constexpr bool Atomic = _Atomic;
+
+    CallableType Callable;
+};
+
+template < typename T >
+SharedFunction( T ) -> SharedFunction< T >;
+
 // Helpers for invoker types.
 namespace InvokerHelpers
 {
-    using LambdaTagType = uintptr_t;
-    using LambdaProcessorType = void( * )( void*&, bool );
-    using LambdaOffsetType = size_t;
+    // Operations performed on an owned callable by its storage manager.
+    enum class StorageOperation
+    {
+        Copy,
+        Move,
+        Destroy
+    };
 
-    static constexpr LambdaTagType LambdaStorageTag = ( LambdaOffsetType )0xABCDEFABCDEFABCD;
-    static constexpr LambdaOffsetType LambdaTagOffset = 0u;
-    static constexpr LambdaOffsetType LambdaProcessorOffset = LambdaTagOffset + sizeof( LambdaTagOffset );
-    static constexpr LambdaOffsetType LambdaOffset = LambdaProcessorOffset + sizeof( LambdaProcessorOffset );
+    // Storage managers own the bound callable of an invoker. An invoker with no manager does not own its target, or owns a trivially
+    // copyable callable in its inline buffer, so copying and destroying it never touches the target's memory. Copy and Move construct
+    // a_Destination from a_Source, Destroy destroys a_Source. Allocated storage is acquired and released with a_Allocator, inline
+    // storage is constructed at the address given in a_Destination. Managers of move-only storage never instantiate Copy.
+    template < typename _Allocator >
+    using StorageManagerType = void( * )( StorageOperation, void*& a_Destination, void* a_Source, const _Allocator& a_Allocator );
 
-    template < typename T >
-    static void LambdaProcessor( void*&, bool );
+    // Allocate and construct an object of type T using a_Allocator.
+    template < typename T, typename _Allocator, typename... Args >
+    static T* AllocateObject( const _Allocator& a_Allocator, Args&&... a_Args )
+    {
+        using TraitsType = typename std::allocator_traits< _Allocator >::template rebind_traits< T >;
 
-    template < typename T >
-    struct LambdaStorage
+        typename TraitsType::allocator_type Allocator( a_Allocator );
+        T* Object = TraitsType::allocate( Allocator, 1 );
+
+        try
+        {
+            TraitsType::construct( Allocator, Object, std::forward< Args >( a_Args )... );
+        }
+        catch ( ... )
+        {
+            TraitsType::deallocate( Allocator, Object, 1 );
+            throw;
+        }
+
+        return Object;
+    }
+
+    // Destroy and deallocate an object of type T that was allocated with AllocateObject.
+    template < typename T, typename _Allocator >
+    static void DeallocateObject( const _Allocator& a_Allocator, T* a_Object )
     {
-        using LambdaType = T;
+        using TraitsType = typename std::allocator_traits< _Allocator >::template rebind_traits< T >;
 
-        LambdaTagType Tag = LambdaStorageTag;
-        LambdaProcessorType Processor = LambdaProcessor< T >;
-        LambdaType Lambda;
+        typename TraitsType::allocator_type Allocator( a_Allocator );
+        TraitsType::destroy( Allocator, a_Object );
+        TraitsType::deallocate( Allocator, a_Object, 1 );
+    }
 
-        template < typename... Args >
-        LambdaStorage( Args&&... a_Args )
-            : Lambda( std::forward< Args >( a_Args )... )
-        {}
+    // Manager for an allocated callable of type T.
+    template < typename T, typename _Allocator, bool _Copyable >
+    static void HeapStorageManager( StorageOperation a_Operation, void*& a_Destination, void* a_Source, const _Allocator& a_Allocator )
+    {
+        switch ( a_Operation )
+        {
+        case StorageOperation::Copy:
+            if constexpr ( _Copyable )
+            {
+                a_Destination = AllocateObject< T >( a_Allocator, *static_cast< T* >( a_Source ) );
+            }
+            break;
+        case StorageOperation::Move:
+            a_Destination = AllocateObject< T >( a_Allocator, std::move( *static_cast< T* >( a_Source ) ) );
+            break;
+        case StorageOperation::Destroy:
+            DeallocateObject( a_Allocator, static_cast< T* >( a_Source ) );
+            break;
+        }
+    }
+
+    // Holds an invoker's allocator. Stateless allocators take up no space.
+    template < typename _Allocator, bool = std::is_empty_v< _Allocator > >
+    class AllocatorHolder
+    {
+    public:
+
+        constexpr AllocatorHolder( const _Allocator& a_Allocator ) : m_Allocator( a_Allocator ) {}
+
+        const _Allocator& GetAllocator() const { return m_Allocator; }
+        void SetAllocator( const _Allocator& a_Allocator ) { m_Allocator = a_Allocator; }
+
+    private:
+
+        _Allocator m_Allocator;
     };
 
-    template < typename T >
-    static void LambdaProcessor( void*& a_Pointer, bool a_Copy )
+    template < typename _Allocator >
+    class AllocatorHolder< _Allocator, true > : private _Allocator
     {
-        if ( a_Copy )
+    public:
+
+        constexpr AllocatorHolder( const _Allocator& a_Allocator ) : _Allocator( a_Allocator ) {}
+
+        const _Allocator& GetAllocator() const { return *this; }
+        void SetAllocator( const _Allocator& ) {}
+    };
+
+    // Inline buffer used to store small callables within an invoker. A union so that constexpr constructors only need to initialise
+    // a single byte of it.
+    template < size_t _Capacity, size_t _Alignment >
+    union InlineBuffer
+    {
+        constexpr InlineBuffer() : Empty() {}
+
+        uint8_t Empty;
+        alignas( _Alignment ) uint8_t Data[ _Capacity ];
+    };
+
+    // Inline storage is disabled.
+    template < size_t _Alignment >
+    union InlineBuffer< 0, _Alignment >
+    {
+        static constexpr uint8_t* Data = nullptr;
+    };
+
+    // Holds an invoker's inline buffer. Invokers with inline storage disabled take up no space for it.
+    template < size_t _Capacity, size_t _Alignment >
+    struct InlineBufferHolder
+    {
+        InlineBuffer< _Capacity, _Alignment > m_Buffer;
+    };
+
+    template < size_t _Alignment >
+    struct InlineBufferHolder< 0, _Alignment >
+    {
+        static constexpr InlineBuffer< 0, _Alignment > m_Buffer{};
+    };
+
+    // Manager for a non trivially copyable callable of type T stored in an inline buffer.
+    template < typename T, typename _Allocator, bool _Copyable >
+    static void InlineStorageManager( StorageOperation a_Operation, void*& a_Destination, void* a_Source, const _Allocator& )
+    {
+        switch ( a_Operation )
         {
-            a_Pointer = new LambdaStorage< T >( ( ( LambdaStorage< T >*& )a_Pointer )->Lambda );
+        case StorageOperation::Copy:
+            if constexpr ( _Copyable )
+            {
+                new ( a_Destination ) T( *static_cast< T* >( a_Source ) );
+            }
+            break;
+        case StorageOperation::Move:
+            new ( a_Destination ) T( std::move( *static_cast< T* >( a_Source ) ) );
+            break;
+        case StorageOperation::Destroy:
+            static_cast< T* >( a_Source )->~T();
+            break;
         }
-        else
+    }
+
+    // Allocated block holding a callable taken from the inline buffer of an invoker with other storage, along with the manager of its
+    // inline storage. Trivially copyable callables have no manager, and are copied with a memcpy.
+    template < size_t _Capacity, size_t _Alignment, typename _Allocator >
+    struct BoxedBlock
+    {
+        StorageManagerType< _Allocator > Manager;
+        alignas( _Alignment ) uint8_t    Data[ _Capacity ];
+
+        // Get the block holding the callable at a_Callable.
+        static BoxedBlock* From( void* a_Callable ) { return reinterpret_cast< BoxedBlock* >( static_cast< uint8_t* >( a_Callable ) - offsetof( BoxedBlock, Data ) ); }
+    };
+
+    // Copy or move the inline callable at a_Source, managed by a_Manager if it has a manager, into a new boxed block. Returns the
+    // address of the boxed callable.
+    template < size_t _Capacity, size_t _Alignment, typename _Allocator >
+    static void* Box( StorageOperation a_Operation, StorageManagerType< _Allocator > a_Manager, void* a_Source, const _Allocator& a_Allocator )
+    {
+        using BlockType = BoxedBlock< _Capacity, _Alignment, _Allocator >;
+
+        BlockType* Block = AllocateObject< BlockType >( a_Allocator );
+        Block->Manager = a_Manager;
+
+        void* Callable = Block->Data;
+
+        if ( !a_Manager )
         {
-            delete ( LambdaStorage< T >*& )a_Pointer;
+            std::memcpy( Callable, a_Source, _Capacity );
+            return Callable;
         }
+
+        try
+        {
+            a_Manager( a_Operation, Callable, a_Source, a_Allocator );
+        }
+        catch ( ... )
+        {
+            DeallocateObject( a_Allocator, Block );
+            throw;
+        }
+
+        return Callable;
     }
 
-    static bool IsLambdaStorage( void* a_Pointer )
+    // Manager for a boxed callable. Copying and moving box the callable again, destroying releases the block.
+    template < size_t _Capacity, size_t _Alignment, typename _Allocator, bool _Copyable >
+    static void BoxedStorageManager( StorageOperation a_Operation, void*& a_Destination, void* a_Source, const _Allocator& a_Allocator )
     {
-        return *( LambdaTagType* )a_Pointer == LambdaStorageTag;
+        using BlockType = BoxedBlock< _Capacity, _Alignment, _Allocator >;
+
+        BlockType* Block = BlockType::From( a_Source );
+
+        switch ( a_Operation )
+        {
+        case StorageOperation::Copy:
+            if constexpr ( _Copyable )
+            {
+                a_Destination = Box< _Capacity, _Alignment >( StorageOperation::Copy, Block->Manager, a_Source, a_Allocator );
+            }
+            break;
+        case StorageOperation::Move:
+            a_Destination = Box< _Capacity, _Alignment >( StorageOperation::Move, Block->Manager, a_Source, a_Allocator );
+            break;
+        case StorageOperation::Destroy:
+            if ( Block->Manager )
+            {
+                Block->Manager( StorageOperation::Destroy, a_Source, a_Source, a_Allocator );
+            }
+            DeallocateObject( a_Allocator, Block );
+            break;
+        }
     }
 
-    static void* GetLambda( void* a_Pointer )
+    // Reference counted storage for a callable bound through a SharedFunction. The block keeps a copy of the allocator it was allocated
+    // with, so that any invoker sharing it can release it. The callable is the first member so that its address is that of the block.
+    template < typename T, typename _Allocator, bool _Atomic >
+    struct SharedBlock
     {
-        return ( uint8_t* )a_Pointer + LambdaOffset;
-    }
+        using CountType = std::conditional_t< _Atomic, std::atomic< uint32_t >, uint32_t >;
 
-    static LambdaProcessorType GetLambdaProcessor( void* a_Pointer )
+        T          Callable;
+        CountType  Count;
+        _Allocator Allocator;
+
+        SharedBlock( T&& a_Callable, const _Allocator& a_Allocator )
+            : Callable( std::move( a_Callable ) )
+            , Count( 1 )
+            , Allocator( a_Allocator )
+        {}
+    };
+
+    // Manager for a shared callable. Copying and moving add a reference, destroying releases one.
+    template < typename T, typename _Allocator, bool _Atomic >
+    static void SharedStorageManager( StorageOperation a_Operation, void*& a_Destination, void* a_Source, const _Allocator& )
     {
-        return *( LambdaProcessorType* )( ( uint8_t* )a_Pointer + LambdaProcessorOffset );
+        using BlockType = SharedBlock< T, _Allocator, _Atomic >;
+
+        BlockType* Block = reinterpret_cast< BlockType* >( a_Source );
+
+        switch ( a_Operation )
+        {
+        case StorageOperation::Copy:
+        case StorageOperation::Move:
+            if constexpr ( _Atomic )
+            {
+                Block->Count.fetch_add( 1, std::memory_order_relaxed );
+            }
+            else
+            {
+                ++Block->Count;
+            }
+            a_Destination = a_Source;
+            break;
+        case StorageOperation::Destroy:
+            if constexpr ( _Atomic )
+            {
+                if ( Block->Count.fetch_sub( 1, std::memory_order_acq_rel ) != 1 )
+                {
+                    return;
+                }
+            }
+            else if ( --Block->Count != 0 )
+            {
+                return;
+            }
+            DeallocateObject( _Allocator( Block->Allocator ), Block );
+            break;
+        }
     }
 
-    static void DestroyLambdaStorage( void* a_Pointer )
+    // Object that invokers bound to a free function point to, so that they are considered bound.
+    inline uint8_t FreeFunctionTarget = 0;
+
+    // Hash of the bound object and function of an invoker, the pair compared by invoker equality.
+    template < typename Function >
+    inline size_t HashBinding( const void* a_Object, Function a_Function )
     {
-        GetLambdaProcessor( a_Pointer )( a_Pointer, false );
+        const size_t Object = std::hash< const void* >()( a_Object );
+        const size_t Thunk = std::hash< uintptr_t >()( reinterpret_cast< uintptr_t >( a_Function ) );
+        return Object ^ ( Thunk + static_cast< size_t >( 0x9e3779b97f4a7c15ull ) + ( Object << 6 ) + ( Object >> 2 ) );
     }
 
-    static void CopyLambdaStorage( void*& a_Pointer )
+    template < typename T >
+    static constexpr bool IsFreeFunction = false;
+
+    template < auto _Function >
+    static constexpr bool IsFreeFunction< FreeFunction< _Function > > = true;
+
+    template < typename T >
+    static constexpr bool IsSharedFunction = false;
+
+    template < typename T, bool _Atomic >
+    static constexpr bool IsSharedFunction< SharedFunction< T, _Atomic > > = true;
+
+    // The type of object a member function is called on when binding T.
+    template < typename T, bool = IsSharedFunction< std::decay_t< T > > >
+    struct BoundObject { using type = std::remove_pointer_t< std::remove_reference_t< T > >; };
+
+    template < typename T >
+    struct BoundObject< T, true > { using type = typename std::decay_t< T >::CallableType; };
+
+    // Can an object of type T be stored within an inline buffer? It must be nothrow move constructible so that invokers can be moved
+    // without throwing. Trivially copyable objects need no storage manager, they are copied and relocated with a memcpy.
+    template < typename T, size_t _Capacity, size_t _Alignment >
+    static constexpr bool IsInlineStorable = sizeof( T ) <= _Capacity && alignof( T ) <= _Alignment && std::is_nothrow_move_constructible_v< T >;
+
+    // Type of the copy constructor parameter of an invoker with storage that cannot be copied. Invokers declare a move constructor,
+    // so their implicit copy constructor is deleted.
+    struct DisabledCopy {};
+
+    // How an argument of type T is passed through invoke calls and thunks. References are passed as they are, small trivially
+    // copyable values by value, and other values by const reference so that no copy is made until the target itself takes one.
+    // Move-only values are passed by rvalue reference, so a target that takes one by value moves from it. Delegates pass the same
+    // reference to every listener, so a listener that takes one by value must be the delegate's only listener.
+    template < typename T >
+    using ParameterType = std::conditional_t< std::is_reference_v< T >, T,
+                          std::conditional_t< std::is_trivially_copyable_v< T > && sizeof( T ) <= 2 * sizeof( void* ), T,
+                          std::conditional_t< std::is_copy_constructible_v< T >, const T&, T&& > > >;
+
+    // Thunks that invokers with signature Return( Args... ) call their bound function through.
+    template < typename Return, typename... Args >
+    struct Thunks
     {
-        GetLambdaProcessor( a_Pointer )( a_Pointer, true );
-    }
+        // Invocation for an unbound invoker. Returns the default Return value.
+        static Return EmptyInvocation( void*, ParameterType< Args >... )
+        {
+            if constexpr ( std::is_void_v< Return > )
+            {
+                return;
+            }
+            else if constexpr ( std::is_default_constructible_v< Return > && !std::is_reference_v< Return > )
+            {
+                return Return();
+            }
+            else
+            {
+                std::terminate();
+            }
+        }
+
+        // Invocation trampoline for a static function stored in place of the object.
+        static Return StaticInvocation( void* a_Object, ParameterType< Args >... a_Args )
+        {
+            return reinterpret_cast< Return( * )( Args... ) >( a_Object )( std::forward< ParameterType< Args > >( a_Args )... );
+        }
+
+        template < auto _Function >
+        static Return Invocation( void* a_Object, ParameterType< Args >... a_Args )
+        {
+            if constexpr ( std::is_member_function_v< decltype( _Function ) > )
+            {
+                using ObjectType = std::function_object_t< decltype( _Function ) >;
+
+                return ( reinterpret_cast< ObjectType* >( a_Object )->*_Function )( std::forward< ParameterType< Args > >( a_Args )... );
+            }
+            else
+            {
+                return _Function( std::forward< ParameterType< Args > >( a_Args )... );
+            }
+        }
+    };
 }
 
 //==========================================================================
@@ -138,57 +517,114 @@ namespace InvokerHelpers
 // - Static lambda
 // - Capture lambda
 // - Invocable object.
+// Small callables are stored within the invoker, as configured by
+// _Storage. Other moved from callables are allocated with the storage's
+// allocator. Invokers with move-only storage can bind move-only callables.
 //==========================================================================
-template < typename Return = void, typename... Args >
-class Invoker
+template < typename _Storage, typename Return, typename... Args >
+class BasicInvoker : private InvokerHelpers::AllocatorHolder< typename _Storage::AllocatorType >, private InvokerHelpers::InlineBufferHolder< _Storage::Capacity, _Storage::Alignment >
 {
 private:
 
-    template < typename, typename... > friend class Invoker;
-    template < typename, typename... > friend class Delegate;
+    template < typename, typename, typename... > friend class BasicInvoker;
+    template < typename, typename, typename... > friend class BasicDelegate;
+    template < typename, typename, typename... > friend class BasicConcurrentDelegate;
+    friend struct std::hash< BasicInvoker >;
 
-    template < auto _Function, bool _UsingLambdaStorage = false >
-    static Return Invocation( void* a_Object, Args... a_Args )
-    {
-        using ObjectType = std::function_object_t< decltype( _Function ) >;
+    using StorageType = _Storage;
+    using AllocatorType = typename StorageType::AllocatorType;
+    using AllocatorTraits = std::allocator_traits< AllocatorType >;
+    using AllocatorHolderType = InvokerHelpers::AllocatorHolder< AllocatorType >;
+    using ManagerType = InvokerHelpers::StorageManagerType< AllocatorType >;
+    using BufferHolderType = InvokerHelpers::InlineBufferHolder< StorageType::Capacity, StorageType::Alignment >;
+    using CopyType = std::conditional_t< StorageType::Copyable, const BasicInvoker&, const InvokerHelpers::DisabledCopy& >;
 
-        if constexpr ( _UsingLambdaStorage )
-        {
-            a_Object = InvokerHelpers::GetLambda( a_Object );
-        }
+    using FunctionType = Return( * )( void*, InvokerHelpers::ParameterType< Args >... );
+    using StaticFunctionType = Return( * )( Args... );
 
-        return ( reinterpret_cast< ObjectType* >( a_Object )->*_Function )( std::forward< Args >( a_Args )... );
-    }
+    // Thunks are shared by every invoker with the same signature, whatever its storage, so that invokers with different storage
+    // bound to the same function compare equal.
+    using ThunksType = InvokerHelpers::Thunks< Return, Args... >;
+
+    static constexpr FunctionType EmptyInvocation = ThunksType::EmptyInvocation;
+    static constexpr FunctionType StaticInvocation = ThunksType::StaticInvocation;
+
+    template < auto _Function >
+    static constexpr FunctionType Invocation = ThunksType::template Invocation< _Function >;
 
 public:
 
+    // Allocator type, allowing containers to construct invokers with their own allocator.
+    using allocator_type = AllocatorType;
+
     // Create an empty invoker.
-    Invoker()
-        : m_Object( nullptr )
-        , m_Function( nullptr )
+    constexpr BasicInvoker()
+        : BasicInvoker( std::allocator_arg, AllocatorType() )
+    {}
+
+    // Create an empty invoker that allocates with the given allocator.
+    constexpr BasicInvoker( std::allocator_arg_t, const AllocatorType& a_Allocator )
+        : AllocatorHolderType( a_Allocator )
+        , m_Object( nullptr )
+        , m_Function( EmptyInvocation )
+        , m_Manager( nullptr )
     {}
 
     // Create an empty invoker.
-    Invoker( std::nullptr_t )
-        : Invoker()
+    constexpr BasicInvoker( std::nullptr_t )
+        : BasicInvoker()
     {}
 
-    // Copy from another Invoker.
-    Invoker( const Invoker& a_Invoker ) : Invoker() { Bind( a_Invoker ); }
+    // Copy from another Invoker. Not available for move-only storage.
+    BasicInvoker( CopyType a_Invoker ) : BasicInvoker( std::allocator_arg, AllocatorTraits::select_on_container_copy_construction( a_Invoker.GetAllocator() ) ) { Bind( a_Invoker ); }
 
     // Move from another Invoker.
-    Invoker( Invoker&& a_Invoker ) noexcept : Invoker() { Bind( std::move( a_Invoker ) ); }
+    BasicInvoker( BasicInvoker&& a_Invoker ) noexcept : BasicInvoker( std::allocator_arg, a_Invoker.GetAllocator() ) { Bind( std::move( a_Invoker ) ); }
 
     // Create from lambda, functor or static funciton.
     template < typename T >
-    Invoker( T&& a_Object ) : Invoker() { Bind( std::forward< T >( a_Object ) ); }
+    BasicInvoker( T&& a_Object ) : BasicInvoker() { Bind( std::forward< T >( a_Object ) ); }
 
-    // Create from an object and member function pair.
+    // Create from lambda, functor, static function or other invoker, allocating with the given allocator.
+    template < typename T >
+    BasicInvoker( std::allocator_arg_t, const AllocatorType& a_Allocator, T&& a_Object ) : BasicInvoker( std::allocator_arg, a_Allocator ) { Bind( std::forward< T >( a_Object ) ); }
+
+    // Create from a compile time bound free function. Can be used in constant expressions.
+    template < auto _Function >
+    constexpr BasicInvoker( FreeFunction< _Function > )
+        : BasicInvoker()
+    {
+        static_assert( std::is_invocable_r_v< Return, decltype( _Function ), Args... >, "Function is not callable with the invoker's arguments." );
+
+        m_Object = &InvokerHelpers::FreeFunctionTarget;
+        m_Function = Invocation< _Function >;
+    }
+
+    // Create from a reference to an object and member function pair. Can be used in constant expressions.
     template < typename T, auto _Function >
-    Invoker( T&& a_Object, MemberFunction< _Function > ) : Invoker() { Bind( std::forward< T >( a_Object ), MemberFunction< _Function >{} ); }
+    constexpr BasicInvoker( T& a_Object, MemberFunction< _Function > )
+        : BasicInvoker()
+    {
+        static_assert( std::is_member_function_compatible_v< decltype( _Function ), T >, "Function type is not callable on given object." );
+
+        m_Object = &a_Object;
+        m_Function = Invocation< _Function >;
+    }
+
+    // Create from a pointer to an object and member function pair. Can be used in constant expressions.
+    template < typename T, auto _Function >
+    constexpr BasicInvoker( T* a_Object, MemberFunction< _Function > ) : BasicInvoker( *a_Object, MemberFunction< _Function >{} ) {}
+
+    // Create from an object and member function pair. Will move from and store r-value referenced objects.
+    template < typename T, auto _Function >
+    BasicInvoker( T&& a_Object, MemberFunction< _Function > ) : BasicInvoker() { Bind( std::forward< T >( a_Object ), MemberFunction< _Function >{} ); }
+
+    // Create from an object and member function pair, allocating with the given allocator.
+    template < typename T, auto _Function >
+    BasicInvoker( std::allocator_arg_t, const AllocatorType& a_Allocator, T&& a_Object, MemberFunction< _Function > ) : BasicInvoker( std::allocator_arg, a_Allocator ) { Bind( std::forward< T >( a_Object ), MemberFunction< _Function >{} ); }
 
     // Clear invoker binding.
-    ~Invoker() { Unbind(); }
+    ~BasicInvoker() { Unbind(); }
 
     // Clear invoker binding.
     void Bind( std::nullptr_t ) { Unbind(); }
@@ -198,13 +634,17 @@ public:
     void Bind( T&& a_Object )
     {
         using ObjectType = std::decay_t< T >;
-        using StaticFunction = Return( * )( Args... );
 
-        // If binding a static function.
-        if constexpr ( std::is_convertible_v < ObjectType, StaticFunction > )
+        // If binding a static function, store it as the object and call it through the static trampoline.
+        if constexpr ( std::is_convertible_v < ObjectType, StaticFunctionType > )
         {
             Unbind();
-            m_Function = static_cast< StaticFunction >( a_Object );
+
+            if ( StaticFunctionType Function = static_cast< StaticFunctionType >( a_Object ) )
+            {
+                m_Object = reinterpret_cast< void* >( Function );
+                m_Function = StaticInvocation;
+            }
         }
 
         // If binding a pointer, rebind as a reference.
@@ -213,33 +653,103 @@ public:
             Bind( *a_Object );
         }
 
-        // If binding another Invoker, copy or move from it.
+        // If binding another Invoker, copy or move from it. A callable in the inline buffer of an invoker with other storage is boxed
+        // into allocated storage, so that it does not need to fit this invoker's buffer.
         else if constexpr ( std::is_invoker_v< ObjectType > )
         {
-            static_assert( std::is_same_v< ObjectType, Invoker >, "Invoker must have the same argument types." );
+            using OtherStorageType = typename ObjectType::StorageType;
+
+            constexpr bool IsSameStorage = std::is_same_v< ObjectType, BasicInvoker >;
+
+            static_assert( std::is_same_v< ObjectType, BasicInvoker< OtherStorageType, Return, Args... > >, "Invoker must have the same argument types." );
+            static_assert( std::is_same_v< typename OtherStorageType::AllocatorType, AllocatorType >, "Invoker must have the same allocator type." );
+            static_assert( !StorageType::Copyable || OtherStorageType::Copyable, "Invoker with copyable storage can not take a callable from move-only storage." );
+
+            if ( static_cast< const void* >( &a_Object ) == this )
+            {
+                return;
+            }
+
+            constexpr bool IsMove = std::is_rvalue_reference_v< decltype( a_Object ) >;
+            constexpr InvokerHelpers::StorageOperation Operation = IsMove ? InvokerHelpers::StorageOperation::Move : InvokerHelpers::StorageOperation::Copy;
+
+            static_assert( IsMove || StorageType::Copyable, "Invoker with move-only storage can not be copied." );
 
             Unbind();
-            m_Function = a_Object.m_Function;
 
-            if constexpr ( std::is_rvalue_reference_v< decltype( a_Object ) > )
+            if constexpr ( IsMove ? AllocatorTraits::propagate_on_container_move_assignment::value : AllocatorTraits::propagate_on_container_copy_assignment::value )
             {
-                m_Object = a_Object.m_Object;
-                a_Object.m_Object = nullptr;
-                a_Object.m_Function = nullptr;
+                this->SetAllocator( a_Object.GetAllocator() );
             }
-            else
+
+            // Allocated storage can be taken over when moving if it can be released through this invoker's allocator.
+            bool TakeOver = false;
+
+            if constexpr ( IsMove )
             {
-                if ( a_Object.m_Object && InvokerHelpers::IsLambdaStorage( a_Object.m_Object ) )
+                TakeOver = a_Object.m_Manager && !a_Object.IsInline() && ( AllocatorTraits::is_always_equal::value || GetAllocator() == a_Object.GetAllocator() );
+            }
+
+            const bool IsBoxed = !IsSameStorage && a_Object.IsInline();
+
+            if ( IsBoxed )
+            {
+                m_Object = InvokerHelpers::Box< OtherStorageType::Capacity, OtherStorageType::Alignment >( Operation, a_Object.m_Manager, a_Object.m_Object, GetAllocator() );
+            }
+
+            // Unmanaged inline storage is trivially copyable, so copying and moving are the same.
+            else if ( !a_Object.m_Manager )
+            {
+                m_Object = a_Object.m_Object;
+
+                if constexpr ( IsSameStorage && StorageType::Capacity > 0 )
                 {
-                    InvokerHelpers::CopyLambdaStorage( m_Object = a_Object.m_Object );
+                    if ( a_Object.IsInline() )
+                    {
+                        m_Buffer = a_Object.m_Buffer;
+                        m_Object = m_Buffer.Data;
+                    }
                 }
-                else
+            }
+            else if ( TakeOver )
+            {
+                m_Object = a_Object.m_Object;
+            }
+
+            // Otherwise the manager constructs a new callable, inline or allocated, from the source.
+            else
+            {
+                void* Object = m_Buffer.Data;
+                a_Object.m_Manager( Operation, Object, a_Object.m_Object, GetAllocator() );
+                m_Object = Object;
+            }
+
+            m_Function = a_Object.m_Function;
+            m_Manager = IsBoxed ? InvokerHelpers::BoxedStorageManager< OtherStorageType::Capacity, OtherStorageType::Alignment, AllocatorType, StorageType::Copyable > : a_Object.m_Manager;
+
+            if constexpr ( IsMove )
+            {
+                if ( TakeOver )
                 {
-                    m_Object = a_Object.m_Object;
+                    a_Object.m_Manager = nullptr;
                 }
+
+                a_Object.Unbind();
             }
         }
 
+        // If binding a free function, call it through its compile time thunk.
+        else if constexpr ( InvokerHelpers::IsFreeFunction< ObjectType > )
+        {
+            *this = BasicInvoker( a_Object );
+        }
+
+        // If binding a shared function, bind its callable in shared ownership mode.
+        else if constexpr ( InvokerHelpers::IsSharedFunction< ObjectType > )
+        {
+            Bind< &ObjectType::CallableType::operator() >( std::forward< T >( a_Object ) );
+        }
+
         // Lambda or Object/Member
         else
         {
@@ -251,10 +761,9 @@ public:
     template < auto _Function, typename T >
     void Bind( T&& a_Object, MemberFunction< _Function > a_Function = MemberFunction< _Function >{} )
     {
-        using FunctionType = decltype( _Function );
         using ObjectType = std::decay_t< T >;
 
-        static_assert( std::is_member_function_compatible_v< decltype( _Function ), std::remove_pointer_t< std::remove_reference_t< T > > >, "Function type is not callable on given object." );
+        static_assert( std::is_member_function_compatible_v< decltype( _Function ), typename InvokerHelpers::BoundObject< T >::type >, "Function type is not callable on given object." );
 
         Unbind();
 
@@ -262,21 +771,52 @@ public:
         if constexpr ( std::is_pointer_v< ObjectType > )
         {
             m_Object = a_Object;
-            m_Function = ( void* )Invocation< _Function >;
+            m_Function = Invocation< _Function >;
+        }
+
+        // If shared function, move its callable to reference counted storage and store accompanying function and manager.
+        else if constexpr ( InvokerHelpers::IsSharedFunction< ObjectType > )
+        {
+            using CallableType = typename ObjectType::CallableType;
+            using BlockType = InvokerHelpers::SharedBlock< CallableType, AllocatorType, ObjectType::Atomic >;
+
+            static_assert( std::is_rvalue_reference_v< decltype( a_Object ) >, "Shared functions must be bound as r-values." );
+
+            m_Object = &InvokerHelpers::AllocateObject< BlockType >( GetAllocator(), std::move( a_Object.Callable ), GetAllocator() )->Callable;
+            m_Function = Invocation< _Function >;
+            m_Manager = InvokerHelpers::SharedStorageManager< CallableType, AllocatorType, ObjectType::Atomic >;
         }
         
-        // If r-value reference, move from object to lambda storage and store accompanying function.
+        // If r-value reference to a small object, move from object to inline storage and store accompanying function. Only objects that
+        // are not trivially copyable need a manager.
+        else if constexpr ( std::is_rvalue_reference_v< decltype( a_Object ) > && InvokerHelpers::IsInlineStorable< ObjectType, StorageType::Capacity, StorageType::Alignment > )
+        {
+            static_assert( !StorageType::Copyable || std::is_copy_constructible_v< ObjectType >, "Object must be copy constructible. Use a UniqueInvoker for move-only objects." );
+
+            m_Object = new ( m_Buffer.Data ) ObjectType( std::move( a_Object ) );
+            m_Function = Invocation< _Function >;
+
+            if constexpr ( !std::is_trivially_copyable_v< ObjectType > )
+            {
+                m_Manager = InvokerHelpers::InlineStorageManager< ObjectType, AllocatorType, StorageType::Copyable >;
+            }
+        }
+
+        // If r-value reference, move from object to allocated storage and store accompanying function and manager.
         else if constexpr ( std::is_rvalue_reference_v< decltype( a_Object ) > )
         {
-            m_Object = new InvokerHelpers::LambdaStorage< ObjectType >( std::move( a_Object ) );
-            m_Function = ( void* )Invocation< _Function, true >;
+            static_assert( !StorageType::Copyable || std::is_copy_constructible_v< ObjectType >, "Object must be copy constructible. Use a UniqueInvoker for move-only objects." );
+
+            m_Object = InvokerHelpers::AllocateObject< ObjectType >( GetAllocator(), std::move( a_Object ) );
+            m_Function = Invocation< _Function >;
+            m_Manager = InvokerHelpers::HeapStorageManager< ObjectType, AllocatorType, StorageType::Copyable >;
         }
 
         // Store reference to object and function.
         else
         {
             m_Object = &a_Object;
-            m_Function = ( void* )Invocation< _Function >;
+            m_Function = Invocation< _Function >;
         }
     }
 
@@ -288,62 +828,79 @@ public:
             return;
         }
 
-        m_Function = nullptr;
-
-        if ( m_Object && InvokerHelpers::IsLambdaStorage( m_Object ) )
+        if ( m_Manager )
         {
-            InvokerHelpers::DestroyLambdaStorage( m_Object );
+            m_Manager( InvokerHelpers::StorageOperation::Destroy, m_Object, m_Object, GetAllocator() );
         }
 
         m_Object = nullptr;
+        m_Function = EmptyInvocation;
+        m_Manager = nullptr;
     }
 
+    // Get the allocator used for stored callables.
+    using AllocatorHolderType::GetAllocator;
+
     // Is the invoker bound to a functor or function?
-    bool IsBound() const { return m_Function; }
+    bool IsBound() const { return m_Object; }
 
     // Is the bound function, if any at all, a static function?
-    bool IsStatic() const { return IsBound() && !m_Object; }
+    bool IsStatic() const { return m_Function == StaticInvocation; }
 
     // Is the bound function, if any at all, a stored function? This applies to capture-lambda's, moved from object/member function pairs or other moved from functors.
-    bool IsLambda() const { return IsBound() && m_Object && InvokerHelpers::IsLambdaStorage( m_Object ); }
+    bool IsLambda() const { return IsBound() && ( m_Manager || IsInline() ); }
 
-    // Invoke the stored callable.
-    Return Invoke( Args... a_Args ) const
+    // Is the bound function, if any at all, a stored function that lives within the invoker's inline buffer?
+    bool IsInline() const
     {
-        return m_Object ?
-            reinterpret_cast< Return( * )( void*, Args... ) >( m_Function )( m_Object, std::forward< Args >( a_Args )... ) :
-            reinterpret_cast< Return( * )( Args... ) >( m_Function )( std::forward< Args >( a_Args )... );
+        if constexpr ( StorageType::Capacity > 0 )
+        {
+            return m_Object == m_Buffer.Data;
+        }
+        else
+        {
+            return false;
+        }
     }
 
-    // Invoke the stored callable if it is bound. If not, default Return type will be returned.
-    Return InvokeSafe( Args... a_Args ) const
+    // Invoke the stored callable. Traced as an invoke event while tracing is enabled.
+    Return Invoke( InvokerHelpers::ParameterType< Args >... a_Args ) const
     {
-        if ( !m_Function )
+#if CALLABLE_TRACING
+        if ( Tracer::IsEnabled() )
         {
-            return Return();
+            return InvokeTraced( std::forward< InvokerHelpers::ParameterType< Args > >( a_Args )... );
         }
+#endif
+
+        return m_Function( m_Object, std::forward< InvokerHelpers::ParameterType< Args > >( a_Args )... );
+    }
 
-        return m_Object ?
-            reinterpret_cast< Return( * )( void*, Args... ) >( m_Function )( m_Object, std::forward< Args >( a_Args )... ) :
-            reinterpret_cast< Return( * )( Args... ) >( m_Function )( std::forward< Args >( a_Args )... );
+    // Invoke the stored callable if it is bound. If not, default Return type will be returned. Unbound invokers call an empty
+    // invocation, so this is the same single indirect call as Invoke.
+    Return InvokeSafe( InvokerHelpers::ParameterType< Args >... a_Args ) const
+    {
+        return Invoke( std::forward< InvokerHelpers::ParameterType< Args > >( a_Args )... );
     }
 
     // Invoke the stored callable. Will not check if invoker is bound beforehand.
-    Return operator()( Args... a_Args ) const
+    Return operator()( InvokerHelpers::ParameterType< Args >... a_Args ) const
     {
-        return m_Object ?
-            reinterpret_cast< Return( * )( void*, Args... ) >( m_Function )( m_Object, std::forward< Args >( a_Args )... ) :
-            reinterpret_cast< Return( * )( Args... ) >( m_Function )( std::forward< Args >( a_Args )... );
+        return Invoke( std::forward< InvokerHelpers::ParameterType< Args > >( a_Args )... );
     }
 
     // Is the invoker bound to a functor or function?
-    operator bool() const { return m_Function; }
+    operator bool() const { return IsBound(); }
 
     // Checks to see if the invoker is bound to the same functor or function and instance as another invoker.
-    bool operator==( const Invoker& a_Invoker ) const { return m_Function == a_Invoker.m_Function && m_Object == a_Invoker.m_Object; }
+    bool operator==( const BasicInvoker& a_Invoker ) const { return m_Function == a_Invoker.m_Function && m_Object == a_Invoker.m_Object; }
+
+    // Checks to see if the invoker is bound to the same functor or function and instance as an invoker with other storage.
+    template < typename _OtherStorage >
+    bool operator==( const BasicInvoker< _OtherStorage, Return, Args... >& a_Invoker ) const { return m_Function == a_Invoker.m_Function && m_Object == a_Invoker.m_Object; }
 
     // Checks to see if the invokers bound function is the same as given static function.
-    bool operator==( Return( *a_Function )( Args... ) ) const { return m_Function == a_Function; }
+    bool operator==( StaticFunctionType a_Function ) const { return IsStatic() && m_Object == reinterpret_cast< void* >( a_Function ); }
 
     // Checks to see if the invokers bound object is the same as the given object.
     template < typename T >
@@ -353,34 +910,62 @@ public:
     bool operator==( std::nullptr_t ) const { return !IsBound(); }
 
     // Checks to see if the invoker is bound to the same functor or function and instance as the one given.
-    template < typename T >
-    bool operator==( T&& a_Object ) const { return *this == Invoker( std::forward< T >( a_Object ) ); }
+    template < typename T, typename = std::enable_if_t< !std::is_invoker_v< std::decay_t< T > > > >
+    bool operator==( T&& a_Object ) const { return *this == BasicInvoker( std::forward< T >( a_Object ) ); }
 
     // Checks to see if the invoker is bound to the same member function as the one provided.
     template < auto _Function >
-    bool operator==( MemberFunction< _Function > ) const { return m_Function == static_cast< void* >( Invocation< _Function > ); }
+    bool operator==( MemberFunction< _Function > ) const { return m_Function == Invocation< _Function >; }
+
+    // Checks to see if the invoker is bound to the same free function as the one provided.
+    template < auto _Function >
+    bool operator==( FreeFunction< _Function > ) const { return m_Function == Invocation< _Function >; }
 
     // Checks to see if the invoker is bound to a different function or functor than the one given.
     template < typename T >
     bool operator!=( T&& a_Object ) const { return !( *this == std::forward< T >( a_Object ) ); }
 
     // Clear invoker binding. Same as Unbind.
-    Invoker& operator=( std::nullptr_t ) { Unbind(); return *this; }
+    BasicInvoker& operator=( std::nullptr_t ) { Unbind(); return *this; }
 
-    // Copy from an invoker.
-    Invoker& operator=( const Invoker& a_Invoker ) { Bind( a_Invoker ); return *this; }
+    // Copy from an invoker. Not available for move-only storage.
+    BasicInvoker& operator=( CopyType a_Invoker ) { Bind( a_Invoker ); return *this; }
 
     // Move from an invoker.
-    Invoker& operator=( Invoker&& a_Invoker ) { Bind( std::move( a_Invoker ) ); return *this; }
+    BasicInvoker& operator=( BasicInvoker&& a_Invoker ) noexcept { Bind( std::move( a_Invoker ) ); return *this; }
 
     // Assign a functor or function to the invoker.
     template < typename T >
-    Invoker& operator=( T&& a_Object ) { Bind( std::forward< T >( a_Object ) ); return *this; }
+    BasicInvoker& operator=( T&& a_Object ) { Bind( std::forward< T >( a_Object ) ); return *this; }
 
 private:
 
-    void* m_Object;
-    void* m_Function;
+    // Invoke the stored callable without tracing it. Delegates call their listeners through this, tracing them as listeners instead.
+    Return InvokeUntraced( InvokerHelpers::ParameterType< Args >... a_Args ) const
+    {
+        return m_Function( m_Object, std::forward< InvokerHelpers::ParameterType< Args > >( a_Args )... );
+    }
+
+#if CALLABLE_TRACING
+    Return InvokeTraced( InvokerHelpers::ParameterType< Args >... a_Args ) const
+    {
+        const Tracer::Scope Scope( TraceHelpers::EventKind::Invoke, nullptr, 0, GetTraceSymbol() );
+        return m_Function( m_Object, std::forward< InvokerHelpers::ParameterType< Args > >( a_Args )... );
+    }
+#endif
+
+    // Get the function named in trace events: the bound function itself for static functions, whose thunk is shared, and the thunk
+    // otherwise, whose symbol names the bound member function or functor type.
+    const void* GetTraceSymbol() const
+    {
+        return IsStatic() ? m_Object : reinterpret_cast< const void* >( m_Function );
+    }
+
+    using BufferHolderType::m_Buffer;
+
+    void*                              m_Object;
+    FunctionType                       m_Function;
+    ManagerType                        m_Manager;
 };
 
 // An Action is an invoker that returns void.
@@ -398,4 +983,14 @@ namespace std
 
     template < auto _Function, typename T >
     static auto make_invoker( T&& a_Object, MemberFunction< _Function > a_Function = MemberFunction< _Function >{} ) { return as_invoker_t< decltype( _Function ) >( forward< T >( a_Object ), a_Function ); }
-}
\ No newline at end of file
+
+    template < bool _Atomic = true, typename T >
+    static auto make_shared_function( T&& a_Object ) { return SharedFunction< decay_t< T >, _Atomic >{ forward< T >( a_Object ) }; }
+
+    // Hashes an invoker by its bound object and function, consistent with invoker equality.
+    template < typename _Storage, typename Return, typename... Args >
+    struct hash< BasicInvoker< _Storage, Return, Args... > >
+    {
+        size_t operator()( const BasicInvoker< _Storage, Return, Args... >& a_Invoker ) const noexcept { return InvokerHelpers::HashBinding( a_Invoker.m_Object, a_Invoker.m_Function ); }
+    };
+}
@@ -0,0 +1,266 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//==========================================================================
+// A pool of worker threads with a task queue per worker. Workers take tasks
+// from the back of their own queue and steal from the front of the others'
+// when it is empty. The thread waiting on a parallel loop runs tasks too, so
+// loops may be nested and a pool with no workers runs loops inline. Threads
+// with nothing to take sleep instead of spinning: workers until a task is
+// queued, and the waiting thread until its loop's last chunk finishes.
+// Delegates accept any pool providing ParallelFor with the same signature.
+//==========================================================================
+class WorkStealingPool
+{
+private:
+
+    // Chunk [Begin, End) of a parallel loop. Tasks are plain data so that queueing them never allocates a callable.
+    struct Task
+    {
+        void( *Function )( void*, size_t, size_t );
+        void*  Context;
+        size_t Begin;
+        size_t End;
+    };
+
+    struct Queue
+    {
+        std::mutex         Mutex;
+        std::deque< Task > Tasks;
+    };
+
+    // Shared state of one parallel loop. Remaining and Exception are guarded by Mutex. The last chunk signals Finished while holding
+    // Mutex, so the waiting thread cannot return and destroy the job before the signal is complete.
+    template < typename Function >
+    struct Job
+    {
+        Function&               Body;
+        size_t                  Remaining;
+        std::mutex              Mutex;
+        std::condition_variable Finished;
+        std::exception_ptr      Exception;
+
+        static void Execute( void* a_Context, size_t a_Begin, size_t a_End )
+        {
+            Job& This = *static_cast< Job* >( a_Context );
+            std::exception_ptr Exception;
+
+            try
+            {
+                This.Body( a_Begin, a_End );
+            }
+            catch ( ... )
+            {
+                Exception = std::current_exception();
+            }
+
+            std::lock_guard< std::mutex > Lock( This.Mutex );
+
+            if ( Exception && !This.Exception )
+            {
+                This.Exception = std::move( Exception );
+            }
+
+            if ( --This.Remaining == 0 )
+            {
+                This.Finished.notify_all();
+            }
+        }
+    };
+
+public:
+
+    // Create a pool with the given number of worker threads. By default one less than the hardware thread count, leaving a thread
+    // for the caller.
+    explicit WorkStealingPool( size_t a_Workers = DefaultWorkerCount() )
+        : m_Queues( a_Workers )
+        , m_Pending( 0 )
+        , m_IsStopping( false )
+    {
+        for ( auto& Entry : m_Queues )
+        {
+            Entry = std::make_unique< Queue >();
+        }
+
+        m_Workers.reserve( a_Workers );
+
+        for ( size_t i = 0; i < a_Workers; ++i )
+        {
+            m_Workers.emplace_back( [ this, i ]() { Work( i ); } );
+        }
+    }
+
+    WorkStealingPool( const WorkStealingPool& ) = delete;
+    WorkStealingPool& operator=( const WorkStealingPool& ) = delete;
+
+    // Stop and join the workers. No loop may be running.
+    ~WorkStealingPool()
+    {
+        {
+            std::lock_guard< std::mutex > Lock( m_Mutex );
+            m_IsStopping = true;
+        }
+
+        m_Condition.notify_all();
+
+        for ( std::thread& Worker : m_Workers )
+        {
+            Worker.join();
+        }
+    }
+
+    // Call a_Function( Begin, End ) for chunks of at most a_Grain indices covering [0, a_Count), on the workers and the calling
+    // thread. Returns once every chunk has finished. The first exception thrown by a chunk is rethrown.
+    template < typename Function >
+    void ParallelFor( size_t a_Count, size_t a_Grain, Function&& a_Function )
+    {
+        a_Grain = a_Grain ? a_Grain : 1;
+
+        if ( m_Workers.empty() || a_Count <= a_Grain )
+        {
+            if ( a_Count )
+            {
+                a_Function( size_t( 0 ), a_Count );
+            }
+
+            return;
+        }
+
+        using JobType = Job< std::remove_reference_t< Function > >;
+
+        const size_t Chunks = ( a_Count + a_Grain - 1 ) / a_Grain;
+        JobType Loop{ a_Function, Chunks, {}, {}, {} };
+
+        // Tasks are counted as they are queued, so that a woken worker always finds the task it was woken for unless another thread
+        // took it first.
+        for ( size_t i = 0; i < Chunks; ++i )
+        {
+            Queue& Target = *m_Queues[ i % m_Queues.size() ];
+            std::lock_guard< std::mutex > Lock( Target.Mutex );
+            Target.Tasks.push_back( Task{ &JobType::Execute, &Loop, i * a_Grain, std::min( a_Count, ( i + 1 ) * a_Grain ) } );
+            m_Pending.fetch_add( 1, std::memory_order_release );
+        }
+
+        {
+            std::lock_guard< std::mutex > Lock( m_Mutex );
+        }
+
+        m_Condition.notify_all();
+
+        // Help while there are tasks to take, tasks of other loops included, then sleep until the chunks taken by workers finish.
+        for ( Task Next; TryTake( GetWorkerIndex(), Next ); )
+        {
+            Next.Function( Next.Context, Next.Begin, Next.End );
+        }
+
+        std::unique_lock< std::mutex > Lock( Loop.Mutex );
+        Loop.Finished.wait( Lock, [ &Loop ]() { return Loop.Remaining == 0; } );
+
+        if ( Loop.Exception )
+        {
+            std::rethrow_exception( Loop.Exception );
+        }
+    }
+
+    // The number of worker threads.
+    size_t Size() const { return m_Workers.size(); }
+
+    // Get a pool shared by the process, created on first use.
+    static WorkStealingPool& GetDefault()
+    {
+        static WorkStealingPool Pool;
+        return Pool;
+    }
+
+private:
+
+    static size_t DefaultWorkerCount()
+    {
+        size_t Threads = std::thread::hardware_concurrency();
+        return Threads > 1 ? Threads - 1 : 0;
+    }
+
+    // Index of the calling thread's queue in this pool, or the queue count if it is not one of its workers.
+    size_t GetWorkerIndex() const
+    {
+        return t_Pool == this ? t_Index : m_Queues.size();
+    }
+
+    // Take a task from the back of the worker's own queue, or steal one from the front of another queue.
+    bool TryTake( size_t a_Index, Task& a_Task )
+    {
+        if ( a_Index < m_Queues.size() )
+        {
+            Queue& Own = *m_Queues[ a_Index ];
+            std::lock_guard< std::mutex > Lock( Own.Mutex );
+
+            if ( !Own.Tasks.empty() )
+            {
+                a_Task = Own.Tasks.back();
+                Own.Tasks.pop_back();
+                m_Pending.fetch_sub( 1, std::memory_order_relaxed );
+                return true;
+            }
+        }
+
+        for ( size_t i = 1; i <= m_Queues.size(); ++i )
+        {
+            Queue& Victim = *m_Queues[ ( a_Index + i ) % m_Queues.size() ];
+            std::lock_guard< std::mutex > Lock( Victim.Mutex );
+
+            if ( !Victim.Tasks.empty() )
+            {
+                a_Task = Victim.Tasks.front();
+                Victim.Tasks.pop_front();
+                m_Pending.fetch_sub( 1, std::memory_order_relaxed );
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void Work( size_t a_Index )
+    {
+        t_Pool = this;
+        t_Index = a_Index;
+
+        for ( ;; )
+        {
+            Task Next;
+
+            if ( TryTake( a_Index, Next ) )
+            {
+                Next.Function( Next.Context, Next.Begin, Next.End );
+                continue;
+            }
+
+            std::unique_lock< std::mutex > Lock( m_Mutex );
+            m_Condition.wait( Lock, [ this ]() { return m_IsStopping || m_Pending.load( std::memory_order_acquire ) != 0; } );
+
+            if ( m_IsStopping )
+            {
+                return;
+            }
+        }
+    }
+
+    static inline thread_local const WorkStealingPool* t_Pool = nullptr;
+    static inline thread_local size_t                  t_Index = 0;
+
+    std::vector< std::unique_ptr< Queue > > m_Queues;
+    std::vector< std::thread >              m_Workers;
+    std::atomic< size_t >                   m_Pending;
+    std::mutex                              m_Mutex;
+    std::condition_variable                 m_Condition;
+    bool                                    m_IsStopping;
+};
@@ -0,0 +1,430 @@
+#pragma once
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Tracing of broadcasts and invocations is compiled in when CALLABLE_TRACING is defined as 1 in every translation unit, as the
+// CALLABLE_TRACING CMake option does. It records nothing until Tracer::Enable is called, and costs one predictable branch per call
+// until then. Otherwise invokers and delegates neither include this header nor check for tracing.
+#ifndef CALLABLE_TRACING
+#define CALLABLE_TRACING 0
+#endif
+
+// Thunk symbols are resolved with dladdr where it is available, and written as addresses otherwise. Executables must export their
+// symbols, with -rdynamic or the ENABLE_EXPORTS target property, for thunks defined in them to resolve.
+#if __has_include( <dlfcn.h> ) && __has_include( <cxxabi.h> )
+#define CALLABLE_TRACE_SYMBOLS 1
+#include <cxxabi.h>
+#include <dlfcn.h>
+#else
+#define CALLABLE_TRACE_SYMBOLS 0
+#endif
+
+// Helpers for tracing.
+namespace TraceHelpers
+{
+    // Kinds of trace events.
+    enum class EventKind : uint8_t
+    {
+        // A delegate started broadcasting.
+        Broadcast,
+
+        // A delegate started calling one of its listeners.
+        Listener,
+
+        // An invoker was invoked directly.
+        Invoke,
+
+        // The most recent unfinished event of the thread finished.
+        End
+    };
+
+    // An event recorded by a thread. Names must outlive the trace, as they are only read when it is flushed.
+    struct Event
+    {
+        uint64_t    Timestamp;
+        const char* Name;
+        const void* Symbol;
+        uint32_t    Index;
+        EventKind   Kind;
+    };
+
+    //==========================================================================
+    // A ring buffer of the events of one thread. The thread writes events at
+    // the head and flushes read them from the tail, so neither waits for the
+    // other. A begin event is only written if its end event will fit too, so
+    // that events stay balanced when the buffer is full. Events that do not
+    // fit are dropped and counted.
+    //==========================================================================
+    class ThreadBuffer
+    {
+    public:
+
+        static constexpr uint32_t Capacity = 1 << 15;
+
+        explicit ThreadBuffer( uint32_t a_Id )
+            : m_Events( Capacity )
+            , m_Head( 0 )
+            , m_Tail( 0 )
+            , m_Dropped( 0 )
+            , m_Reserved( 0 )
+            , m_Id( a_Id )
+            , m_IsOwned( true )
+        {}
+
+        // Write a begin event, keeping room for its end event. Returns false, dropping the event, if the buffer is full.
+        bool Begin( const Event& a_Event )
+        {
+            const uint64_t Head = m_Head.load( std::memory_order_relaxed );
+
+            if ( Head - m_Tail.load( std::memory_order_acquire ) + m_Reserved + 2 > Capacity )
+            {
+                m_Dropped.store( m_Dropped.load( std::memory_order_relaxed ) + 1, std::memory_order_relaxed );
+                return false;
+            }
+
+            Write( Head, a_Event );
+            ++m_Reserved;
+            return true;
+        }
+
+        // Write the end event of a begin event that was written.
+        void End( uint64_t a_Timestamp )
+        {
+            --m_Reserved;
+            Write( m_Head.load( std::memory_order_relaxed ), Event{ a_Timestamp, nullptr, nullptr, 0, EventKind::End } );
+        }
+
+        // Call a_Read( Event ) for every event written since the last read, oldest first, and free their places in the buffer.
+        template < typename Function >
+        void Read( Function&& a_Read )
+        {
+            const uint64_t Head = m_Head.load( std::memory_order_acquire );
+            uint64_t Tail = m_Tail.load( std::memory_order_relaxed );
+
+            for ( ; Tail != Head; ++Tail )
+            {
+                a_Read( m_Events[ Tail & ( Capacity - 1 ) ] );
+            }
+
+            m_Tail.store( Tail, std::memory_order_release );
+        }
+
+        // Has every written event been read?
+        bool IsEmpty() const { return m_Head.load( std::memory_order_acquire ) == m_Tail.load( std::memory_order_acquire ); }
+
+        // Get the count of events dropped because the buffer was full.
+        uint64_t GetDropped() const { return m_Dropped.load( std::memory_order_relaxed ); }
+
+        // Get the trace thread id of the buffer's thread.
+        uint32_t GetId() const { return m_Id; }
+
+        // Give the buffer to a new thread, once the previous one has exited and its events have been read.
+        void Claim( uint32_t a_Id ) { m_Id = a_Id; m_IsOwned = true; }
+
+        // Release the buffer when its thread exits. Its events can still be read.
+        void Release() { m_IsOwned = false; }
+
+        // Is the buffer used by a running thread?
+        bool IsOwned() const { return m_IsOwned; }
+
+    private:
+
+        void Write( uint64_t a_Head, const Event& a_Event )
+        {
+            m_Events[ a_Head & ( Capacity - 1 ) ] = a_Event;
+            m_Head.store( a_Head + 1, std::memory_order_release );
+        }
+
+        std::vector< Event >    m_Events;
+        std::atomic< uint64_t > m_Head;
+        std::atomic< uint64_t > m_Tail;
+        std::atomic< uint64_t > m_Dropped;
+        uint32_t                m_Reserved;
+        uint32_t                m_Id;
+        bool                    m_IsOwned;
+    };
+}
+
+//==========================================================================
+// The tracer records begin and end events of delegate broadcasts, of the
+// listeners they call and of invokers invoked directly, into a buffer per
+// thread. Flush writes them as a Chrome trace event JSON document, which
+// chrome://tracing and Perfetto open, showing nested broadcasts as nested
+// slices on each thread's timeline.
+//==========================================================================
+class Tracer
+{
+public:
+
+    // Writes a begin event when constructed and its end event when destroyed.
+    class Scope
+    {
+    public:
+
+        Scope( TraceHelpers::EventKind a_Kind, const char* a_Name, size_t a_Index, const void* a_Symbol )
+            : m_Buffer( &GetThreadBuffer() )
+        {
+            if ( !m_Buffer->Begin( TraceHelpers::Event{ Now(), a_Name, a_Symbol, static_cast< uint32_t >( a_Index ), a_Kind } ) )
+            {
+                m_Buffer = nullptr;
+            }
+        }
+
+        Scope( const Scope& ) = delete;
+        Scope& operator=( const Scope& ) = delete;
+
+        ~Scope()
+        {
+            if ( m_Buffer )
+            {
+                m_Buffer->End( Now() );
+            }
+        }
+
+    private:
+
+        TraceHelpers::ThreadBuffer* m_Buffer;
+    };
+
+    // Is tracing enabled? This is the only test made on the hot path while tracing is disabled.
+    static bool IsEnabled() { return s_IsEnabled.load( std::memory_order_relaxed ); }
+
+    // Start recording events.
+    static void Enable() { GetRegistry(); s_IsEnabled.store( true, std::memory_order_relaxed ); }
+
+    // Stop recording events. Events of broadcasts and invocations already started still end.
+    static void Disable() { s_IsEnabled.store( false, std::memory_order_relaxed ); }
+
+    // Get the count of events dropped because a thread's buffer was full, since the program started.
+    static uint64_t GetDropped()
+    {
+        Registry& Threads = GetRegistry();
+        std::lock_guard< std::mutex > Lock( Threads.Mutex );
+
+        uint64_t Dropped = 0;
+
+        for ( const std::unique_ptr< TraceHelpers::ThreadBuffer >& Buffer : Threads.Buffers )
+        {
+            Dropped += Buffer->GetDropped();
+        }
+
+        return Dropped;
+    }
+
+    // Take the events recorded by every thread since the last flush, as a Chrome trace event JSON document. Threads keep recording
+    // while events are flushed. Events whose begin was flushed before their end have their end in the next document.
+    static std::string Flush()
+    {
+        Registry& Threads = GetRegistry();
+        std::lock_guard< std::mutex > Lock( Threads.Mutex );
+
+        std::unordered_map< const void*, std::string > Symbols;
+        std::string Json = "{\"traceEvents\":[";
+        bool IsFirst = true;
+
+        for ( const std::unique_ptr< TraceHelpers::ThreadBuffer >& Buffer : Threads.Buffers )
+        {
+            Buffer->Read( [&]( const TraceHelpers::Event& a_Event )
+            {
+                Json += IsFirst ? "\n" : ",\n";
+                IsFirst = false;
+                Append( Json, a_Event, Buffer->GetId(), Symbols );
+            } );
+        }
+
+        Json += "\n],\"displayTimeUnit\":\"ns\"}\n";
+        return Json;
+    }
+
+private:
+
+    // Buffers of every thread that has recorded events. Buffers outlive their threads, so that their events can be flushed, and
+    // are given to new threads once they have been.
+    struct Registry
+    {
+        std::mutex                                                 Mutex;
+        std::vector< std::unique_ptr< TraceHelpers::ThreadBuffer > > Buffers;
+        uint32_t                                                   NextId = 1;
+        std::chrono::steady_clock::time_point                      Epoch = std::chrono::steady_clock::now();
+    };
+
+    // Releases the buffer of a thread when it exits.
+    struct BufferOwner
+    {
+        ~BufferOwner()
+        {
+            if ( Buffer )
+            {
+                std::lock_guard< std::mutex > Lock( GetRegistry().Mutex );
+                Buffer->Release();
+            }
+        }
+
+        TraceHelpers::ThreadBuffer* Buffer;
+    };
+
+    static Registry& GetRegistry()
+    {
+        static Registry Threads;
+        return Threads;
+    }
+
+    // Get the calling thread's buffer, taking one on its first event.
+    static TraceHelpers::ThreadBuffer& GetThreadBuffer()
+    {
+        if ( t_Owner.Buffer )
+        {
+            return *t_Owner.Buffer;
+        }
+
+        Registry& Threads = GetRegistry();
+        std::lock_guard< std::mutex > Lock( Threads.Mutex );
+
+        for ( const std::unique_ptr< TraceHelpers::ThreadBuffer >& Buffer : Threads.Buffers )
+        {
+            if ( !Buffer->IsOwned() && Buffer->IsEmpty() )
+            {
+                Buffer->Claim( Threads.NextId++ );
+                return *( t_Owner.Buffer = Buffer.get() );
+            }
+        }
+
+        Threads.Buffers.push_back( std::make_unique< TraceHelpers::ThreadBuffer >( Threads.NextId++ ) );
+        return *( t_Owner.Buffer = Threads.Buffers.back().get() );
+    }
+
+    // Get the time since tracing was first enabled, in nanoseconds.
+    static uint64_t Now()
+    {
+        return static_cast< uint64_t >( std::chrono::duration_cast< std::chrono::nanoseconds >( std::chrono::steady_clock::now() - GetRegistry().Epoch ).count() );
+    }
+
+    // Get the demangled symbol of a function, or its address if it has no symbol, as a JSON string value. Symbols are resolved once
+    // per flush, as thunk symbols are long and repeated by every call.
+    static const std::string& Symbolise( const void* a_Address, std::unordered_map< const void*, std::string >& a_Symbols )
+    {
+        auto Found = a_Symbols.find( a_Address );
+
+        if ( Found != a_Symbols.end() )
+        {
+            return Found->second;
+        }
+
+        std::string& Symbol = a_Symbols[ a_Address ];
+        Symbol += '"';
+
+#if CALLABLE_TRACE_SYMBOLS
+        Dl_info Info;
+
+        if ( dladdr( a_Address, &Info ) && Info.dli_sname && Info.dli_saddr == a_Address )
+        {
+            int Status = 0;
+            char* Demangled = abi::__cxa_demangle( Info.dli_sname, nullptr, nullptr, &Status );
+            AppendEscaped( Symbol, Status == 0 && Demangled ? Demangled : Info.dli_sname );
+            std::free( Demangled );
+            Symbol += '"';
+            return Symbol;
+        }
+#endif
+
+        char Address[ 32 ];
+        std::snprintf( Address, sizeof( Address ), "%p\"", a_Address );
+        Symbol += Address;
+        return Symbol;
+    }
+
+    // Append a string to a JSON document, escaped for use within a string value.
+    static void AppendEscaped( std::string& a_Json, const char* a_String )
+    {
+        const char* Run = a_String;
+
+        for ( const char* Character = a_String; *Character; ++Character )
+        {
+            if ( *Character != '"' && *Character != '\\' && static_cast< unsigned char >( *Character ) >= 0x20 )
+            {
+                continue;
+            }
+
+            char Escaped[ 8 ];
+            std::snprintf( Escaped, sizeof( Escaped ), "\\u%04x", static_cast< unsigned >( static_cast< unsigned char >( *Character ) ) );
+            a_Json.append( Run, Character );
+            a_Json += Escaped;
+            Run = Character + 1;
+        }
+
+        a_Json += Run;
+    }
+
+    // Append a number to a JSON document.
+    static void AppendNumber( std::string& a_Json, uint64_t a_Number )
+    {
+        char Digits[ 20 ];
+        a_Json.append( Digits, std::to_chars( Digits, Digits + sizeof( Digits ), a_Number ).ptr );
+    }
+
+    // Append an event to a JSON document as a Chrome trace duration event.
+    static void Append( std::string& a_Json, const TraceHelpers::Event& a_Event, uint32_t a_Thread, std::unordered_map< const void*, std::string >& a_Symbols )
+    {
+        a_Json += a_Event.Kind == TraceHelpers::EventKind::End ? "{\"ph\":\"E\",\"ts\":" : "{\"ph\":\"B\",\"ts\":";
+        AppendNumber( a_Json, a_Event.Timestamp / 1000 );
+        a_Json += '.';
+        a_Json += static_cast< char >( '0' + a_Event.Timestamp / 100 % 10 );
+        a_Json += static_cast< char >( '0' + a_Event.Timestamp / 10 % 10 );
+        a_Json += static_cast< char >( '0' + a_Event.Timestamp % 10 );
+        a_Json += ",\"pid\":1,\"tid\":";
+        AppendNumber( a_Json, a_Thread );
+
+        if ( a_Event.Kind == TraceHelpers::EventKind::End )
+        {
+            a_Json += '}';
+            return;
+        }
+
+        const char* Name = a_Event.Name ? a_Event.Name : "Delegate";
+
+        switch ( a_Event.Kind )
+        {
+        case TraceHelpers::EventKind::Broadcast:
+            a_Json += ",\"cat\":\"broadcast\",\"name\":\"";
+            AppendEscaped( a_Json, Name );
+            a_Json += "\",\"args\":{\"delegate\":\"";
+            AppendEscaped( a_Json, Name );
+            a_Json += "\"}}";
+            break;
+
+        case TraceHelpers::EventKind::Listener:
+            a_Json += ",\"cat\":\"listener\",\"name\":\"";
+            AppendEscaped( a_Json, Name );
+            a_Json += '[';
+            AppendNumber( a_Json, a_Event.Index );
+            a_Json += "]\",\"args\":{\"delegate\":\"";
+            AppendEscaped( a_Json, Name );
+            a_Json += "\",\"index\":";
+            AppendNumber( a_Json, a_Event.Index );
+            a_Json += ",\"thunk\":";
+            a_Json += Symbolise( a_Event.Symbol, a_Symbols );
+            a_Json += "}}";
+            break;
+
+        default:
+            a_Json += ",\"cat\":\"invoke\",\"name\":";
+            a_Json += Symbolise( a_Event.Symbol, a_Symbols );
+            a_Json += ",\"args\":{\"thunk\":";
+            a_Json += Symbolise( a_Event.Symbol, a_Symbols );
+            a_Json += "}}";
+            break;
+        }
+    }
+
+    static inline std::atomic< bool > s_IsEnabled{ false };
+    static inline thread_local BufferOwner t_Owner{};
+};
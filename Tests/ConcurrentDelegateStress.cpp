@@ -0,0 +1,111 @@
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "Test.hpp"
+#include "../Callable/ConcurrentDelegate.hpp"
+
+// Counts live copies, so that tests can tell when retired snapshots have destroyed their callables.
+struct Tracked
+{
+	static inline std::atomic< int > Live{ 0 };
+
+	Tracked() { ++Live; }
+	Tracked( const Tracked& ) { ++Live; }
+	Tracked( Tracked&& ) noexcept { ++Live; }
+	~Tracked() { --Live; }
+};
+
+struct Listener
+{
+	std::atomic< int > Sum{ 0 };
+	void OnEvent( int a_Value ) { Sum.fetch_add( a_Value, std::memory_order_relaxed ); }
+};
+
+// Readers broadcast while writers add, remove and clear. Run with CALLABLE_SANITIZERS=address or thread to check that no reader
+// sees a freed snapshot and that publishing snapshots does not race.
+static void BroadcastWhileModifying()
+{
+	static constexpr int Readers = 4;
+	static constexpr int Writers = 2;
+	static constexpr int Modifications = 2000;
+
+	ConcurrentDelegate< void, int > Event;
+	std::vector< Listener > Targets( Writers * 8 );
+	std::atomic< int > Calls{ 0 };
+	std::atomic< bool > IsDone{ false };
+	std::vector< std::thread > Threads;
+
+	for ( int i = 0; i < Readers; ++i )
+	{
+		Threads.emplace_back( [&]()
+		{
+			while ( !IsDone.load( std::memory_order_relaxed ) )
+			{
+				Event( 1 );
+			}
+		} );
+	}
+
+	for ( int i = 0; i < Writers; ++i )
+	{
+		Threads.emplace_back( [&, i]()
+		{
+			for ( int j = 0; j < Modifications; ++j )
+			{
+				Listener* Target = &Targets[ i * 8 + j % 8 ];
+
+				if ( j % 3 == 2 )
+				{
+					Event.Remove< &Listener::OnEvent >( Target );
+				}
+				else
+				{
+					Event.Add< &Listener::OnEvent >( Target );
+					Event.Add( [&Calls, Guard = Tracked()]( int a_Value ) { Calls.fetch_add( a_Value, std::memory_order_relaxed ); } );
+				}
+
+				if ( j % 256 == 255 )
+				{
+					Event.Clear();
+				}
+			}
+		} );
+	}
+
+	for ( int i = Readers; i < Readers + Writers; ++i )
+	{
+		Threads[ i ].join();
+	}
+
+	IsDone.store( true, std::memory_order_relaxed );
+
+	for ( int i = 0; i < Readers; ++i )
+	{
+		Threads[ i ].join();
+	}
+
+	Event.Clear();
+	Event.Reclaim();
+	CHECK( Tracked::Live.load() == 0 );
+	CHECK( Event.Reclaim() == 0 );
+}
+
+// A snapshot retired while a broadcast reads it is freed by that broadcast as it returns, without another modification.
+static void ReclaimAfterBroadcast()
+{
+	ConcurrentDelegate< void, int > Event;
+	Event.Add( [&Event, Guard = Tracked()]( int ) { Event.Clear(); } );
+	CHECK( Tracked::Live.load() == 1 );
+
+	Event( 0 );
+	CHECK( Event.Empty() );
+	CHECK( Tracked::Live.load() == 0 );
+}
+
+int main()
+{
+	BroadcastWhileModifying();
+	ReclaimAfterBroadcast();
+	return Test::Result();
+}
@@ -0,0 +1,101 @@
+#include <vector>
+
+#include "Test.hpp"
+#include "../Callable/Delegate.hpp"
+#include "../Callable/EventQueue.hpp"
+#include "../Callable/ThreadPool.hpp"
+
+#if CALLABLE_COROUTINES
+// Coroutine that starts eagerly and is destroyed by its owner.
+struct Task
+{
+	struct promise_type
+	{
+		Task get_return_object() { return Task{ std::coroutine_handle< promise_type >::from_promise( *this ) }; }
+		std::suspend_never initial_suspend() { return {}; }
+		std::suspend_always final_suspend() noexcept { return {}; }
+		void return_void() {}
+		void unhandled_exception() { std::terminate(); }
+	};
+
+	explicit Task( std::coroutine_handle< promise_type > a_Handle ) : Handle( a_Handle ) {}
+	Task( const Task& ) = delete;
+	~Task() { Handle.destroy(); }
+
+	std::coroutine_handle< promise_type > Handle;
+};
+
+// Record the arguments of the next a_Count broadcasts of a_Event.
+template < typename _Delegate >
+static Task Await( const _Delegate& a_Event, int a_Count, std::vector< int >& a_Received )
+{
+	for ( int i = 0; i < a_Count; ++i )
+	{
+		const auto [ Value ] = co_await a_Event.Next();
+		a_Received.push_back( Value );
+	}
+}
+
+struct RecurseTraits : DelegateTraits
+{
+	static constexpr DelegateReentrancy Reentrancy = DelegateReentrancy::Recurse;
+};
+
+struct QueueTraits : DelegateTraits
+{
+	static constexpr DelegateReentrancy Reentrancy = DelegateReentrancy::Queue;
+};
+
+// Nested broadcasts resume awaiters with their own arguments, whether they are recursed or queued, and dropped ones do not.
+template < typename _Traits >
+static void AwaitNested( const std::vector< int >& a_Expected )
+{
+	BasicDelegate< _Traits, void, int > Event;
+	Event.Add( [&Event]( int a_Value ) { if ( a_Value == 1 ) Event( 2 ); } );
+
+	std::vector< int > Received;
+	const Task Awaiting = Await( Event, 2, Received );
+
+	Event( 1 );
+	CHECK( Received == a_Expected );
+}
+
+// Each event of a drained batch, and each parallel broadcast, resumes awaiters.
+static void AwaitBatchAndParallel()
+{
+	ParallelDelegate< void, int > Event;
+	Event.Add( []( int ) {} );
+	EventQueue< ParallelDelegate< void, int > > Queue( Event );
+
+	std::vector< int > Received;
+	const Task Awaiting = Await( Event, 4, Received );
+
+	Queue.Enqueue( 1 );
+	Queue.Enqueue( 2 );
+	Queue.Drain();
+	CHECK( Received == std::vector< int >( { 1, 2 } ) );
+
+	WorkStealingPool Pool( 2 );
+	Event.BroadcastParallel( Pool, 1, 3 );
+	CHECK( Received == std::vector< int >( { 1, 2, 3 } ) );
+
+	ParallelDelegate< int, int > Query;
+	Query.AddParallel( []( int a_Value ) { return a_Value; } );
+
+	std::vector< int > Queried;
+	const Task Querying = Await( Query, 1, Queried );
+	Query.CollectParallel( Pool, 1, 4 );
+	CHECK( Queried == std::vector< int >( { 4 } ) );
+}
+#endif
+
+int main()
+{
+#if CALLABLE_COROUTINES
+	AwaitNested< DelegateTraits >( { 1 } );
+	AwaitNested< RecurseTraits >( { 2, 1 } );
+	AwaitNested< QueueTraits >( { 1, 2 } );
+	AwaitBatchAndParallel();
+#endif
+	return Test::Result();
+}
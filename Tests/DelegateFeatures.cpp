@@ -0,0 +1,169 @@
+#include <memory>
+#include <vector>
+
+#include "Test.hpp"
+#include "../Callable/Delegate.hpp"
+
+// Per invoker flags, priorities and slots are only kept by delegates whose traits use them.
+static_assert( sizeof( Delegate< void, int > ) < sizeof( HandleDelegate< void, int > ) );
+static_assert( sizeof( Delegate< void, int > ) < sizeof( PriorityDelegate< void, int > ) );
+static_assert( sizeof( Delegate< void, int > ) < sizeof( ParallelDelegate< void, int > ) );
+
+// Listeners taking a move-only argument by value or by rvalue reference would move it away from the listeners after them.
+using PointerArguments = std::tuple< std::unique_ptr< int > >;
+static_assert( !DelegateHelpers::SharesArguments< PointerArguments, void( * )( std::unique_ptr< int > ) >::value );
+static_assert( !DelegateHelpers::SharesArguments< PointerArguments, void( * )( std::unique_ptr< int >&& ) >::value );
+static_assert( DelegateHelpers::SharesArguments< PointerArguments, void( * )( const std::unique_ptr< int >& ) >::value );
+
+struct Listener
+{
+	std::vector< int >* Received = nullptr;
+	int Id = 0;
+	void OnEvent( int ) { Received->push_back( Id ); }
+};
+
+// A plain delegate returns invalid handles, and is still modified by callable and by index.
+static void PlainDelegate()
+{
+	std::vector< int > Received;
+	Listener Targets[ 3 ] = { { &Received, 0 }, { &Received, 1 }, { &Received, 2 } };
+
+	Delegate< void, int > Event;
+	for ( Listener& Target : Targets )
+	{
+		CHECK( !Event.Add< &Listener::OnEvent >( &Target ) );
+	}
+
+	CHECK( !Event.GetHandle( 0 ) );
+	CHECK( Event.GetPriority( 0 ).Value == 0 );
+
+	Event.Remove< &Listener::OnEvent >( &Targets[ 0 ] );
+	Event.Remove( size_t( 0 ) );
+	Event( 0 );
+	CHECK( Received == std::vector< int >( { 1 } ) );
+
+	Delegate< void, int > Moved = std::move( Event );
+	Moved.Add< &Listener::OnEvent >( size_t( 0 ), &Targets[ 0 ] );
+	Moved( 0 );
+	CHECK( Received == std::vector< int >( { 1, 0, 1 } ) );
+}
+
+// Handles and priorities keep working on delegates with the traits that enable them.
+static void TraitDelegates()
+{
+	std::vector< int > Received;
+	Listener Targets[ 3 ] = { { &Received, 0 }, { &Received, 1 }, { &Received, 2 } };
+
+	HandleDelegate< void, int > Handled;
+	const DelegateHandle First = Handled.Add< &Listener::OnEvent >( &Targets[ 0 ] );
+	const DelegateHandle Second = Handled.Add< &Listener::OnEvent >( &Targets[ 1 ] );
+	Handled.Remove( First );
+	CHECK( !Handled.Contains( First ) && Handled.IndexOf( Second ) == 0 );
+
+	PriorityDelegate< void, int > Prioritised;
+	Prioritised.Add< &Listener::OnEvent >( &Targets[ 0 ] );
+	Prioritised.Add< &Listener::OnEvent >( DelegatePriority( 2 ), &Targets[ 2 ] );
+	Prioritised.Add< &Listener::OnEvent >( DelegatePriority( 1 ), &Targets[ 1 ] );
+	Prioritised( 0 );
+	CHECK( Received == std::vector< int >( { 2, 1, 0 } ) );
+	CHECK( Prioritised.GetPriority( 0 ).Value == 2 );
+}
+
+// A const broadcast skips invokers whose target has been destroyed without removing them, and the next add removes them.
+static void WeakTargets()
+{
+	std::vector< int > Received;
+	auto First = std::make_shared< Listener >( Listener{ &Received, 0 } );
+	auto Second = std::make_shared< Listener >( Listener{ &Received, 1 } );
+
+	WeakDelegate< void, int > Event;
+	const WeakDelegate< void, int >& Source = Event;
+	Event.Add< &Listener::OnEvent >( First );
+	Event.Add< &Listener::OnEvent >( Second );
+
+	First.reset();
+	Source( 0 );
+	CHECK( Received == std::vector< int >( { 1 } ) );
+	CHECK( Event.GetInvocationList().size() == 2 );
+
+	Event.Add< &Listener::OnEvent >( Second );
+	CHECK( Event.GetInvocationList().size() == 2 );
+
+	Source( 0 );
+	CHECK( Received == std::vector< int >( { 1, 1, 1 } ) );
+}
+
+// Every listener sees a move-only argument, passed to each by const reference. A listener taking it by value can only be the
+// delegate's only listener.
+static void MoveOnlyArguments()
+{
+	std::vector< int > Received;
+
+	HandleDelegate< void, std::unique_ptr< int > > Event;
+	CHECK( Event.Add( [&Received]( const std::unique_ptr< int >& a_Value ) { Received.push_back( a_Value ? *a_Value : -1 ); } ) );
+	CHECK( Event.Add( [&Received]( const std::unique_ptr< int >& a_Value ) { Received.push_back( a_Value ? *a_Value * 2 : -1 ); } ) );
+	CHECK( !Event.Add( [&Received]( std::unique_ptr< int > a_Value ) { Received.push_back( a_Value ? *a_Value : -1 ); } ) );
+	Event( std::make_unique< int >( 7 ) );
+	CHECK( Received == std::vector< int >( { 7, 14 } ) );
+
+	HandleDelegate< void, std::unique_ptr< int > > Sink;
+	std::unique_ptr< int > Taken;
+	CHECK( Sink.Add( [&Taken]( std::unique_ptr< int > a_Value ) { Taken = std::move( a_Value ); } ) );
+	CHECK( !Sink.Add( [&Taken]( std::unique_ptr< int > a_Value ) { Taken = std::move( a_Value ); } ) );
+	CHECK( !Sink.Add( [&Received]( const std::unique_ptr< int >& a_Value ) { Received.push_back( a_Value ? *a_Value : -1 ); } ) );
+	CHECK( Sink.Size() == 1 );
+	Sink( std::make_unique< int >( 3 ) );
+	CHECK( Taken && *Taken == 3 );
+
+	Sink.Clear();
+	CHECK( Sink.Add( [&Received]( const std::unique_ptr< int >& a_Value ) { Received.push_back( a_Value ? *a_Value : -1 ); } ) );
+}
+
+// Instrumented delegates count each listener's calls, with a histogram of their latencies unless the traits leave it out.
+struct CountedDelegateTraits : InstrumentedDelegateTraits
+{
+	static constexpr bool ListenerLatencies = false;
+};
+
+template < typename _Delegate >
+static void CheckStatistics( bool a_HasLatencies )
+{
+	std::vector< int > Received;
+	Listener Targets[ 2 ] = { { &Received, 0 }, { &Received, 1 } };
+
+	_Delegate Event;
+	for ( Listener& Target : Targets )
+	{
+		Event.template Add< &Listener::OnEvent >( &Target );
+	}
+
+	for ( int i = 0; i < 5; ++i )
+	{
+		Event( i );
+	}
+
+	const DelegateStatistics Statistics = Event.GetStatistics();
+	CHECK( Statistics.Broadcasts.Calls == 5 && Statistics.Calls.Calls == 10 && Statistics.Calls.Latency.TotalCount() == 10 );
+	CHECK( Statistics.Listeners.size() == 2 );
+
+	for ( const DelegateListenerStatistics& Calls : Statistics.Listeners )
+	{
+		CHECK( Calls.Calls == 5 && Calls.Latency.TotalCount() == ( a_HasLatencies ? 5 : 0 ) );
+	}
+}
+
+static void Instrumentation()
+{
+	CheckStatistics< InstrumentedDelegate< void, int > >( true );
+	CheckStatistics< BasicDelegate< CountedDelegateTraits, void, int > >( false );
+}
+
+int main()
+{
+	PlainDelegate();
+	TraitDelegates();
+	WeakTargets();
+	MoveOnlyArguments();
+	Instrumentation();
+	return Test::Result();
+}
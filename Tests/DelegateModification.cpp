@@ -0,0 +1,243 @@
+#include <vector>
+
+#include "Test.hpp"
+#include "../Callable/Delegate.hpp"
+#include "../Callable/EventQueue.hpp"
+
+struct Listener
+{
+	int Sum = 0;
+	void OnEvent( int a_Value ) { Sum += a_Value; }
+};
+
+// Removes itself from its delegate the first time it is called.
+struct Remover
+{
+	Delegate< void, int >* Event = nullptr;
+	std::vector< int >*    Received = nullptr;
+
+	void OnEvent( int a_Value )
+	{
+		Received->push_back( a_Value );
+		Event->Remove< &Remover::OnEvent >( this );
+	}
+};
+
+struct State
+{
+	std::vector< int > Received;
+	int Calls = 0;
+};
+
+// A listener that adds to its own delegate grows the invocation list while it is running. Its captures, stored in its invoker's
+// inline buffer, are read after the list has grown.
+static void AddDuringBroadcast()
+{
+	Delegate< void, int > Event;
+	State Listeners;
+
+	Event.Add( [&Event, &Listeners]( int a_Value )
+	{
+		for ( int i = 0; i < 64; ++i )
+		{
+			Event.Add( [&Listeners]( int ) { ++Listeners.Calls; } );
+		}
+
+		Listeners.Received.push_back( a_Value );
+	} );
+	CHECK( Event.GetInvocationList()[ 0 ].IsInline() );
+
+	Event( 1 );
+	CHECK( Listeners.Received.size() == 1 && Listeners.Received[ 0 ] == 1 );
+	CHECK( Event.Size() == 65 );
+
+	Event( 2 );
+	CHECK( Listeners.Received.size() == 2 && Listeners.Received[ 1 ] == 2 );
+	CHECK( Event.Size() == 129 );
+}
+
+// The same, with the listener called while an event queue drains.
+static void AddDuringDrain()
+{
+	Delegate< void, int > Event;
+	EventQueue< Delegate< void, int > > Queue( Event );
+	State Listeners;
+
+	Event.Add( [&Event, &Listeners]( int a_Value )
+	{
+		for ( int i = 0; i < 64; ++i )
+		{
+			Event.Add( [&Listeners]( int ) { ++Listeners.Calls; } );
+		}
+
+		Listeners.Received.push_back( a_Value );
+	} );
+
+	Queue.Enqueue( 1 );
+	Queue.Enqueue( 2 );
+	CHECK( Queue.Drain() == 2 );
+	CHECK( Listeners.Received == std::vector< int >( { 1, 2 } ) );
+}
+
+// Draining runs as one broadcast of the delegate: each listener receives the whole batch before the next, broadcasts started by
+// listeners are handled as reentrant, and a listener that removes itself receives none of the remaining events.
+static void DrainAsBroadcast()
+{
+	Delegate< void, int > Event;
+	EventQueue< Delegate< void, int > > Queue( Event );
+	std::vector< int > Received;
+	bool IsBroadcasting = true;
+
+	Event.Add( [&Received]( int a_Value ) { Received.push_back( 10 + a_Value ); } );
+	Event.Add( [&]( int a_Value )
+	{
+		IsBroadcasting &= Event.IsBroadcasting();
+		Event( a_Value );
+		Received.push_back( 20 + a_Value );
+	} );
+
+	std::vector< int > Removed;
+	Remover Target{ &Event, &Removed };
+	Event.Add< &Remover::OnEvent >( &Target );
+
+	Queue.Enqueue( 1 );
+	Queue.Enqueue( 2 );
+	Queue.Enqueue( 3 );
+	CHECK( Queue.Drain() == 3 );
+
+	CHECK( Received == std::vector< int >( { 11, 12, 13, 21, 22, 23 } ) );
+	CHECK( Removed == std::vector< int >( { 1 } ) );
+	CHECK( IsBroadcasting && !Event.IsBroadcasting() );
+	CHECK( Event.GetReentrancyCounters().Dropped == 3 );
+	CHECK( Event.Size() == 2 );
+}
+
+static int FreeCalls = 0;
+static void Free( int ) { ++FreeCalls; }
+
+// Removing every match from a delegate that keeps its order leaves tombstones, and compacts once afterwards rather than while the
+// invocation list is being visited.
+static void RemoveAllStable()
+{
+	StableDelegate< void, int > Event;
+	State Listeners;
+
+	Event.Add( [&Listeners]( int a_Value ) { Listeners.Received.push_back( a_Value ); } );
+	Event.Add( [&Listeners]( int ) { ++Listeners.Calls; } );
+	Event.Add( &Free );
+	Event.Add( &Free );
+
+	Event.Remove( size_t( 0 ) );
+	Event.RemoveAll( &Free );
+	CHECK( Event.Size() == 1 );
+
+	Event( 1 );
+	CHECK( Listeners.Calls == 1 && Listeners.Received.empty() && FreeCalls == 0 );
+
+	Listener Target;
+	Event.Add< &Listener::OnEvent >( &Target );
+	Event.Add< &Listener::OnEvent >( &Target );
+	Event.Add( &Free );
+	Event.Remove( &Free );
+	Event.RemoveAll< &Listener::OnEvent >( &Target );
+	CHECK( Event.Size() == 1 );
+
+	Event.Add< &Listener::OnEvent >( &Target );
+	Event.Add< &Listener::OnEvent >( &Target );
+	Event.Add( &Free );
+	Event.Remove( &Free );
+	CHECK( Event.RemoveObject( &Target ) == 2 );
+
+	Event( 2 );
+	CHECK( Listeners.Calls == 2 && Target.Sum == 0 && FreeCalls == 0 );
+}
+
+// A listener removing an invoker that has already been called, during a broadcast, neither skips the invokers after it nor calls
+// any of them twice, whether or not the delegate has priorities.
+template < typename _Delegate >
+static void RemoveDuringBroadcast()
+{
+	_Delegate Event;
+	std::vector< int > Received;
+
+	Event.Add( [&Received]( int ) { Received.push_back( 0 ); } );
+	Event.Add( [&Received]( int ) { Received.push_back( 1 ); } );
+	Event.Add( [&Event, &Received]( int )
+	{
+		Received.push_back( 2 );
+		Event.Remove( size_t( 0 ) );
+	} );
+	Event.Add( [&Received]( int ) { Received.push_back( 3 ); } );
+
+	Event( 1 );
+	CHECK( Received == std::vector< int >( { 0, 1, 2, 3 } ) );
+	CHECK( Event.Size() == 3 );
+}
+
+// Broadcasting a delegate that keeps its order through a const reference leaves the tombstones of invokers removed by listeners in
+// place, and the next add compacts them.
+static void CompactAfterConstBroadcast()
+{
+	StableDelegate< void, int > Event;
+	const StableDelegate< void, int >& Source = Event;
+	std::vector< int > Received;
+
+	Event.Add( [&Received]( int ) { Received.push_back( 0 ); } );
+	Event.Add( [&Event, &Received]( int )
+	{
+		Received.push_back( 1 );
+		Event.Remove( size_t( 0 ) );
+	} );
+
+	Source( 1 );
+	CHECK( Event.Size() == 1 && Event.GetInvocationList().size() == 2 );
+
+	Event.Add( [&Received]( int ) { Received.push_back( 2 ); } );
+	CHECK( Event.Size() == 2 && Event.GetInvocationList().size() == 2 );
+
+	Source( 2 );
+	CHECK( Received == std::vector< int >( { 0, 1, 1, 2 } ) );
+}
+
+// Invokers added to a delegate are found again by invokers bound to the same function, whatever their storage.
+static void AddInvoker()
+{
+	Delegate< void, int > Event;
+	Listener Target;
+	State Listeners;
+
+	const Invoker< void, int > Member( Target, MemberFunction< &Listener::OnEvent >{} );
+	const Invoker< void, int > Lambda( [&Listeners]( int a_Value ) { Listeners.Received.push_back( a_Value ); } );
+	CHECK( Lambda.IsInline() );
+
+	Event.Add( Member );
+	Event.Add( Lambda );
+	Event.Add< &Listener::OnEvent >( &Target );
+
+	Event( 3 );
+	CHECK( Target.Sum == 6 );
+	CHECK( Listeners.Received == std::vector< int >( { 3 } ) );
+
+	Event.Remove( Member );
+	CHECK( Event.Size() == 2 );
+	Event.Remove< &Listener::OnEvent >( &Target );
+	CHECK( Event.Size() == 1 );
+
+	Delegate< void, int > Copy = Event;
+	Copy( 4 );
+	CHECK( Listeners.Received == std::vector< int >( { 3, 4 } ) );
+}
+
+int main()
+{
+	AddDuringBroadcast();
+	AddDuringDrain();
+	DrainAsBroadcast();
+	RemoveAllStable();
+	RemoveDuringBroadcast< Delegate< void, int > >();
+	RemoveDuringBroadcast< PriorityDelegate< void, int > >();
+	RemoveDuringBroadcast< SoaDelegate< void, int > >();
+	CompactAfterConstBroadcast();
+	AddInvoker();
+	return Test::Result();
+}
@@ -0,0 +1,73 @@
+#include <memory>
+
+#include "Test.hpp"
+#include "../Callable/Delegate.hpp"
+
+// Invokers are three pointers followed by their inline buffer, which takes no space when inline storage is disabled.
+static_assert( sizeof( BasicInvoker< InvokerStorage< 0 >, void, int > ) == 3 * sizeof( void* ) );
+static_assert( sizeof( Invoker< void, int > ) == 3 * sizeof( void* ) + InvokerStorage<>::Capacity );
+static_assert( sizeof( PmrInvoker< void, int > ) == 4 * sizeof( void* ) + PmrInvokerStorage::Capacity );
+static_assert( sizeof( UniqueInvoker< void, int > ) == sizeof( Invoker< void, int > ) );
+
+struct Listener
+{
+	int Sum = 0;
+	void OnEvent( int a_Value ) { Sum += a_Value; }
+};
+
+// An invoker without inline storage allocates every stored callable, and copies it into allocated storage when copied.
+static void HeapStorage()
+{
+	using HeapInvoker = BasicInvoker< InvokerStorage< 0 >, int, int >;
+
+	int Offset = 1;
+	HeapInvoker Lambda( [Offset]( int a_Value ) { return a_Value + Offset; } );
+	CHECK( Lambda.IsLambda() && !Lambda.IsInline() );
+	CHECK( Lambda( 1 ) == 2 );
+
+	HeapInvoker Copy = Lambda;
+	CHECK( Copy( 2 ) == 3 );
+	CHECK( Copy != Lambda );
+
+	Listener Target;
+	BasicInvoker< InvokerStorage< 0 >, void, int > Member( Target, MemberFunction< &Listener::OnEvent >{} );
+	Member( 3 );
+	CHECK( Target.Sum == 3 );
+}
+
+// A move-only callable counting its moves, small enough to be stored inline.
+struct Counted
+{
+	Counted( int* a_Moves, int a_Value ) : Moves( a_Moves ), Value( std::make_unique< int >( a_Value ) ) {}
+	Counted( Counted&& a_Other ) noexcept : Moves( a_Other.Moves ), Value( std::move( a_Other.Value ) ) { ++*Moves; }
+	void operator()( int& a_Sum ) const { a_Sum += *Value; }
+
+	int* Moves;
+	std::unique_ptr< int > Value;
+};
+
+// A move-only capture is moved once into its invoker's inline buffer, and never again as a delegate of move-only invokers grows.
+static void UniqueStorage()
+{
+	int Moves = 0;
+	UniqueDelegate< void, int& > Event;
+
+	for ( int i = 1; i <= 100; ++i )
+	{
+		Event.Add( Counted( &Moves, i ) );
+	}
+
+	CHECK( Moves == 100 );
+	CHECK( Event.GetInvocationList()[ 0 ].IsInline() );
+
+	int Sum = 0;
+	Event( Sum );
+	CHECK( Sum == 5050 && Moves == 100 );
+}
+
+int main()
+{
+	HeapStorage();
+	UniqueStorage();
+	return Test::Result();
+}
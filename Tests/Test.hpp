@@ -0,0 +1,29 @@
+#pragma once
+#include <cstdio>
+#include <cstdlib>
+
+//==========================================================================
+// Shared helpers for the test executables. Each test is its own
+// executable, registered with CTest, which fails if any check failed.
+// Checks are kept in release builds, unlike assert.
+//==========================================================================
+namespace Test
+{
+    inline int Failures = 0;
+
+    // Report a failed check.
+    inline void Fail( const char* a_Condition, const char* a_File, int a_Line )
+    {
+        std::fprintf( stderr, "%s:%d: check failed: %s\n", a_File, a_Line, a_Condition );
+        ++Failures;
+    }
+
+    // Get the exit code of the test executable.
+    inline int Result()
+    {
+        return Failures ? EXIT_FAILURE : EXIT_SUCCESS;
+    }
+}
+
+// Check that a condition holds, reporting it with its location if it does not.
+#define CHECK( a_Condition ) ( ( a_Condition ) ? void() : Test::Fail( #a_Condition, __FILE__, __LINE__ ) )
@@ -0,0 +1,128 @@
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "Test.hpp"
+#include "../Callable/Delegate.hpp"
+#include "../Callable/ThreadPool.hpp"
+
+struct Listener
+{
+	std::atomic< int > Sum{ 0 };
+	void OnEvent( int a_Value ) { Sum.fetch_add( a_Value, std::memory_order_relaxed ); }
+	int Twice( int a_Value ) { return a_Value * 2; }
+};
+
+// Every index is visited exactly once, by nested loops too, and the first exception thrown by a chunk reaches the caller.
+static void ParallelFor()
+{
+	WorkStealingPool Pool( 3 );
+	std::vector< std::atomic< int > > Visits( 10000 );
+
+	Pool.ParallelFor( Visits.size(), 7, [&]( size_t a_Begin, size_t a_End )
+	{
+		for ( size_t i = a_Begin; i < a_End; ++i )
+		{
+			Visits[ i ].fetch_add( 1, std::memory_order_relaxed );
+		}
+	} );
+
+	bool IsExact = true;
+	for ( const std::atomic< int >& Count : Visits )
+	{
+		IsExact &= Count.load() == 1;
+	}
+	CHECK( IsExact );
+
+	std::atomic< int > Nested{ 0 };
+	Pool.ParallelFor( 8, 1, [&]( size_t, size_t )
+	{
+		Pool.ParallelFor( 8, 1, [&]( size_t, size_t ) { Nested.fetch_add( 1, std::memory_order_relaxed ); } );
+	} );
+	CHECK( Nested.load() == 64 );
+
+	bool IsThrown = false;
+	try
+	{
+		Pool.ParallelFor( 16, 1, [&]( size_t a_Begin, size_t ) { if ( a_Begin == 5 ) throw std::runtime_error( "chunk" ); } );
+	}
+	catch ( const std::runtime_error& )
+	{
+		IsThrown = true;
+	}
+	CHECK( IsThrown );
+
+	WorkStealingPool Inline( 0 );
+	const std::thread::id Caller = std::this_thread::get_id();
+	bool IsInline = true;
+	Inline.ParallelFor( 100, 1, [&]( size_t, size_t ) { IsInline &= std::this_thread::get_id() == Caller; } );
+	CHECK( IsInline );
+}
+
+// The calling thread sleeps while workers run long chunks, instead of spinning. Its own chunk is short, so that the workers take the
+// others, and spinning would cost about a core for the rest of the loop. Process CPU time covers every thread.
+static void IdleThreadsSleep()
+{
+	WorkStealingPool Pool( 3 );
+	const std::thread::id Caller = std::this_thread::get_id();
+
+	const std::clock_t Begin = std::clock();
+	Pool.ParallelFor( 4, 1, [&]( size_t, size_t ) { std::this_thread::sleep_for( std::chrono::milliseconds( std::this_thread::get_id() == Caller ? 20 : 300 ) ); } );
+	const double Seconds = static_cast< double >( std::clock() - Begin ) / CLOCKS_PER_SEC;
+
+	CHECK( Seconds < 0.15 );
+}
+
+// Parallel safe invokers run on the pool, the others on the calling thread first, and collected results keep invocation list order.
+static void ParallelBroadcast()
+{
+	WorkStealingPool Pool( 3 );
+	std::vector< Listener > Targets( 64 );
+
+	ParallelDelegate< void, int > Event;
+	for ( Listener& Target : Targets )
+	{
+		Event.AddParallel< &Listener::OnEvent >( &Target );
+	}
+
+	const std::thread::id Caller = std::this_thread::get_id();
+	bool IsOnCaller = false;
+	Event.Add( [&]( int ) { IsOnCaller = std::this_thread::get_id() == Caller; } );
+
+	Event.BroadcastParallel( Pool, 4, 3 );
+
+	int Sum = 0;
+	for ( const Listener& Target : Targets )
+	{
+		Sum += Target.Sum.load();
+	}
+	CHECK( Sum == 64 * 3 );
+	CHECK( IsOnCaller );
+
+	ParallelDelegate< int, int > Query;
+	for ( Listener& Target : Targets )
+	{
+		Query.AddParallel< &Listener::Twice >( &Target );
+	}
+
+	const std::vector< int > Results = Query.CollectParallel( Pool, 4, 5 );
+	CHECK( Results.size() == Targets.size() );
+
+	bool IsCollected = true;
+	for ( int Result : Results )
+	{
+		IsCollected &= Result == 10;
+	}
+	CHECK( IsCollected );
+}
+
+int main()
+{
+	ParallelFor();
+	IdleThreadsSleep();
+	ParallelBroadcast();
+	return Test::Result();
+}